@@ -0,0 +1,94 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Awaiters.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Window.hpp"
+// Standard Library
+#include <algorithm>
+
+
+namespace Strawberry::Window
+{
+	EventAwaiter::EventAwaiter(Window& window, EventFilter filter)
+		: mWindow(&window)
+		, mFilter(filter)
+	{}
+
+
+	EventAwaiter::~EventAwaiter()
+	{
+		if (!mHandle) return;
+
+		if (mWindow)
+		{
+			std::erase(mWindow->mEventAwaiters, this);
+		}
+		else
+		{
+			Window::CancelReady(mHandle);
+		}
+	}
+
+
+	bool EventAwaiter::await_ready()
+	{
+		mEvent = mFilter
+			? mWindow->mEventQueue.PopIf(mFilter)
+			: mWindow->mEventQueue.Pop();
+		return mEvent.HasValue();
+	}
+
+
+	void EventAwaiter::await_suspend(std::coroutine_handle<> handle)
+	{
+		mHandle = handle;
+		mWindow->mEventAwaiters.emplace_back(this);
+	}
+
+
+	Event EventAwaiter::await_resume()
+	{
+		mHandle = nullptr;
+		return mEvent.Unwrap();
+	}
+
+
+	CloseAwaiter::CloseAwaiter(Window& window)
+		: mWindow(&window)
+	{}
+
+
+	CloseAwaiter::~CloseAwaiter()
+	{
+		if (!mHandle) return;
+
+		if (mWindow)
+		{
+			std::erase(mWindow->mCloseAwaiters, this);
+		}
+		else
+		{
+			Window::CancelReady(mHandle);
+		}
+	}
+
+
+	bool CloseAwaiter::await_ready() const
+	{
+		return mWindow->CloseRequested();
+	}
+
+
+	void CloseAwaiter::await_suspend(std::coroutine_handle<> handle)
+	{
+		mHandle = handle;
+		mWindow->mCloseAwaiters.emplace_back(this);
+	}
+
+
+	void CloseAwaiter::await_resume() noexcept
+	{
+		mHandle = nullptr;
+	}
+}
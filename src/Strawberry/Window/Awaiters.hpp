@@ -0,0 +1,71 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Types/Optional.hpp"
+// Standard Library
+#include <coroutine>
+#include <functional>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	class Window;
+
+
+	// Schedules the resumption of a coroutine that was waiting on a window.
+	using Executor = std::function<void(std::coroutine_handle<>)>;
+
+
+	// Completes with the next event accepted by the filter, taking it from the queue if one is already waiting there.
+	// Awaiting events is not thread safe. Awaiters must be created and resumed on the thread calling PollInput().
+	class EventAwaiter
+	{
+		friend class Window;
+
+	public:
+		EventAwaiter(Window& window, EventFilter filter);
+		EventAwaiter(const EventAwaiter&)            = delete;
+		EventAwaiter& operator=(const EventAwaiter&) = delete;
+		~EventAwaiter();
+
+
+		bool  await_ready();
+		void  await_suspend(std::coroutine_handle<> handle);
+		Event await_resume();
+
+	private:
+		Window*                 mWindow;
+		EventFilter             mFilter;
+		std::coroutine_handle<> mHandle;
+		Core::Optional<Event>   mEvent;
+	};
+
+
+	// Completes once the window has been asked to close.
+	class CloseAwaiter
+	{
+		friend class Window;
+
+	public:
+		explicit CloseAwaiter(Window& window);
+		CloseAwaiter(const CloseAwaiter&)            = delete;
+		CloseAwaiter& operator=(const CloseAwaiter&) = delete;
+		~CloseAwaiter();
+
+
+		bool await_ready() const;
+		void await_suspend(std::coroutine_handle<> handle);
+		void await_resume() noexcept;
+
+	private:
+		Window*                 mWindow;
+		std::coroutine_handle<> mHandle;
+	};
+}
@@ -0,0 +1,72 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Event.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <cstring>
+#include <new>
+
+
+namespace Strawberry::Window::Events
+{
+	Drop::Drop(std::span<const char* const> paths)
+		: mCount(paths.size())
+	{
+		ZoneScoped;
+
+		size_t characterCount = 0;
+		for (const char* path : paths)
+		{
+			characterCount += std::strlen(path);
+		}
+
+		const size_t characterBlocks = (characterCount + sizeof(StorageBlock) - 1) / sizeof(StorageBlock);
+		auto         storage         = std::make_shared_for_overwrite<StorageBlock[]>(mCount + characterBlocks);
+
+		auto* views      = reinterpret_cast<std::string_view*>(storage.get());
+		auto* characters = reinterpret_cast<char*>(storage.get() + mCount);
+		for (size_t i = 0; i < mCount; i++)
+		{
+			const size_t length = std::strlen(paths[i]);
+			std::memcpy(characters, paths[i], length);
+			std::construct_at(views + i, characters, length);
+			characters += length;
+		}
+
+		mStorage = std::move(storage);
+	}
+
+
+	size_t Drop::Count() const noexcept
+	{
+		return mCount;
+	}
+
+
+	std::span<const std::string_view> Drop::Paths() const noexcept
+	{
+		return {Views(), mCount};
+	}
+
+
+	std::string_view Drop::operator[](size_t index) const noexcept
+	{
+		return Views()[index];
+	}
+
+
+	std::filesystem::path Drop::Path(size_t index) const
+	{
+		// GLFW reports UTF-8. Narrow strings would be decoded with the active code page on Windows.
+		const std::string_view path = Views()[index];
+		return {std::u8string_view(reinterpret_cast<const char8_t*>(path.data()), path.size())};
+	}
+
+
+	const std::string_view* Drop::Views() const noexcept
+	{
+		return std::launder(reinterpret_cast<const std::string_view*>(mStorage.get()));
+	}
+}
@@ -8,6 +8,11 @@
 // Strawberry Core
 #include "Strawberry/Core/Types/Variant.hpp"
 #include "Strawberry/Core/Math/Vector.hpp"
+// Standard Library
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
 
 
 namespace Strawberry::Window
@@ -55,6 +60,38 @@ namespace Strawberry::Window
 		{
 			bool focussed;
 		};
+
+
+		// Paths dropped onto the window.
+		// All paths share a single allocation, which is shared between copies of the event.
+		class Drop
+		{
+		public:
+			explicit Drop(std::span<const char* const> paths);
+
+
+			size_t Count() const noexcept;
+
+			std::span<const std::string_view> Paths() const noexcept;
+			std::string_view                  operator[](size_t index) const noexcept;
+			// Paths are UTF-8 encoded.
+			std::filesystem::path             Path(size_t index) const;
+
+		private:
+			// Unit of storage with the size and alignment of a path view, so the views are aligned by construction.
+			struct alignas(std::string_view) StorageBlock
+			{
+				std::byte bytes[sizeof(std::string_view)];
+			};
+
+
+			const std::string_view* Views() const noexcept;
+
+
+			// The path views, followed by the path characters they refer to.
+			std::shared_ptr<const StorageBlock[]> mStorage;
+			size_t                                mCount = 0;
+		};
 	}
 
 
@@ -64,5 +101,19 @@ namespace Strawberry::Window
 		Events::MouseMove,
 		Events::MouseButton,
 		Events::MouseScroll,
-		Events::Focus>;
+		Events::Focus,
+		Events::Drop>;
+
+
+	struct TimedEvent
+	{
+		Event  event;
+		// Seconds on the GLFW timer at which the event's callback ran. This is the dispatch time inside PollInput(),
+		// not the time of the input itself, so events from one poll carry nearly equal timestamps.
+		double timestamp;
+	};
+
+
+	// Selects events of interest. A null filter accepts every event.
+	using EventFilter = bool (*)(const Event&);
 }
@@ -0,0 +1,132 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "EventBus.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <algorithm>
+#include <ranges>
+#include <utility>
+
+
+namespace Strawberry::Window
+{
+	EventBus::Cursor::Cursor(EventBus& bus, EventFilter filter, uint64_t position)
+		: mBus(&bus)
+		, mFilter(filter)
+		, mPosition(position)
+	{
+		mBus->mCursors.emplace_back(this);
+	}
+
+
+	EventBus::Cursor::Cursor(Cursor&& rhs) noexcept
+		: mBus(std::exchange(rhs.mBus, nullptr))
+		, mFilter(rhs.mFilter)
+		, mPosition(rhs.mPosition)
+	{
+		if (mBus)
+		{
+			std::ranges::replace(mBus->mCursors, &rhs, this);
+		}
+	}
+
+
+	EventBus::Cursor& EventBus::Cursor::operator=(Cursor&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			std::destroy_at(this);
+			std::construct_at(this, std::move(rhs));
+		}
+
+		return *this;
+	}
+
+
+	EventBus::Cursor::~Cursor()
+	{
+		if (mBus)
+		{
+			std::erase(mBus->mCursors, this);
+		}
+	}
+
+
+	const Event* EventBus::Cursor::Next()
+	{
+		Core::Assert(mBus != nullptr);
+
+		for (auto& segment : mBus->mSegments)
+		{
+			const uint64_t end = segment.first + segment.events.size();
+			if (mPosition >= end) continue;
+
+			while (mPosition < end)
+			{
+				const Event& event = segment.events[mPosition++ - segment.first];
+				if (!mFilter || mFilter(event))
+				{
+					return &event;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+
+	EventBus::~EventBus()
+	{
+		Core::Assert(mCursors.empty());
+	}
+
+
+	EventBus::Cursor EventBus::CreateCursor(EventFilter filter)
+	{
+		return Cursor(*this, filter, EndPosition());
+	}
+
+
+	bool EventBus::HasCursors() const noexcept
+	{
+		return !mCursors.empty();
+	}
+
+
+	void EventBus::Append(Event event)
+	{
+		if (mSegments.empty())
+		{
+			mSegments.emplace_back(Segment{.first = 0, .events = {}});
+		}
+
+		mSegments.back().events.emplace_back(std::move(event));
+	}
+
+
+	void EventBus::EndFrame()
+	{
+		ZoneScoped;
+
+		const uint64_t end = EndPosition();
+
+		const uint64_t released = mCursors.empty()
+			? end
+			: std::ranges::min(mCursors | std::views::transform([] (const Cursor* cursor) { return cursor->mPosition; }));
+
+		while (!mSegments.empty() && mSegments.front().first + mSegments.front().events.size() <= released)
+		{
+			mSegments.pop_front();
+		}
+
+		mSegments.emplace_back(Segment{.first = end, .events = {}});
+	}
+
+
+	uint64_t EventBus::EndPosition() const noexcept
+	{
+		return mSegments.empty() ? 0 : mSegments.back().first + mSegments.back().events.size();
+	}
+}
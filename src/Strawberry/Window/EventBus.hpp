@@ -0,0 +1,79 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+// Standard Library
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	// Append-only log of a window's events, read non-destructively by any number of cursors.
+	// The log is split into one segment per PollInput(). A segment is released once every cursor has passed it.
+	// The bus is not thread safe, and must only be used from the thread calling PollInput().
+	class EventBus
+	{
+	public:
+		class Cursor
+		{
+			friend class EventBus;
+
+		public:
+			Cursor(const Cursor&)            = delete;
+			Cursor& operator=(const Cursor&) = delete;
+			Cursor(Cursor&& rhs) noexcept;
+			Cursor& operator=(Cursor&& rhs) noexcept;
+			~Cursor();
+
+
+			// Returns the next event accepted by this cursor's filter, or nullptr if it has caught up.
+			// The event remains valid until the next call to PollInput().
+			const Event* Next();
+
+		private:
+			Cursor(EventBus& bus, EventFilter filter, uint64_t position);
+
+
+			EventBus*   mBus;
+			EventFilter mFilter;
+			uint64_t    mPosition;
+		};
+
+
+		EventBus() = default;
+		EventBus(const EventBus&)            = delete;
+		EventBus& operator=(const EventBus&) = delete;
+		~EventBus();
+
+
+		// Creates a cursor which will read every event appended from now on.
+		Cursor CreateCursor(EventFilter filter = nullptr);
+		bool   HasCursors() const noexcept;
+
+
+		void Append(Event event);
+		// Seals the current segment and releases every segment all cursors have passed.
+		void EndFrame();
+
+	private:
+		struct Segment
+		{
+			uint64_t           first;
+			std::vector<Event> events;
+		};
+
+
+		uint64_t EndPosition() const noexcept;
+
+
+		std::deque<Segment>  mSegments;
+		std::vector<Cursor*> mCursors;
+	};
+}
@@ -0,0 +1,229 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "EventQueue.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <algorithm>
+
+
+namespace Strawberry::Window
+{
+	EventQueue::EventQueue(EventQueue&& rhs) noexcept
+	{
+		std::scoped_lock lock(rhs.mMutex);
+		mEvents     = std::move(rhs.mEvents);
+		mCapacity   = rhs.mCapacity;
+		mPolicy     = rhs.mPolicy;
+		mStatistics = rhs.mStatistics;
+	}
+
+
+	EventQueue& EventQueue::operator=(EventQueue&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			std::scoped_lock lock(mMutex, rhs.mMutex);
+			mEvents     = std::move(rhs.mEvents);
+			mCapacity   = rhs.mCapacity;
+			mPolicy     = rhs.mPolicy;
+			mStatistics = rhs.mStatistics;
+		}
+
+		return *this;
+	}
+
+
+	void EventQueue::SetCapacity(size_t capacity, OverflowPolicy policy)
+	{
+		std::unique_lock lock(mMutex);
+		mCapacity = capacity;
+		mPolicy   = policy;
+
+		if (mCapacity != 0 && mPolicy != OverflowPolicy::Block)
+		{
+			while (mEvents.size() > mCapacity)
+			{
+				mEvents.pop_front();
+				mStatistics.droppedOldest++;
+			}
+		}
+	}
+
+
+	size_t EventQueue::GetCapacity() const
+	{
+		std::unique_lock lock(mMutex);
+		return mCapacity;
+	}
+
+
+	OverflowPolicy EventQueue::GetOverflowPolicy() const
+	{
+		std::unique_lock lock(mMutex);
+		return mPolicy;
+	}
+
+
+	void EventQueue::Push(Event event, double timestamp)
+	{
+		ZoneScoped;
+
+		std::unique_lock lock(mMutex);
+
+		if (mCapacity != 0 && mEvents.size() >= mCapacity && !MakeRoom(event))
+		{
+			return;
+		}
+
+		mEvents.emplace_back(TimedEvent{.event = std::move(event), .timestamp = timestamp});
+	}
+
+
+	Core::Optional<Event> EventQueue::Pop()
+	{
+		auto timed = PopTimed();
+		if (!timed)
+		{
+			return {};
+		}
+
+		return std::move(timed->event);
+	}
+
+
+	Core::Optional<TimedEvent> EventQueue::PopTimed()
+	{
+		std::unique_lock lock(mMutex);
+
+		if (mEvents.empty())
+		{
+			return {};
+		}
+
+		TimedEvent event(std::move(mEvents.front()));
+		mEvents.pop_front();
+		return event;
+	}
+
+
+	size_t EventQueue::Size() const
+	{
+		std::unique_lock lock(mMutex);
+		return mEvents.size();
+	}
+
+
+	bool EventQueue::Empty() const
+	{
+		std::unique_lock lock(mMutex);
+		return mEvents.empty();
+	}
+
+
+	bool EventQueue::BlockIfFull()
+	{
+		std::unique_lock lock(mMutex);
+
+		if (mPolicy != OverflowPolicy::Block || mCapacity == 0 || mEvents.size() < mCapacity)
+		{
+			return false;
+		}
+
+		mStatistics.blocked++;
+		return true;
+	}
+
+
+	EventQueueStatistics EventQueue::GetStatistics() const
+	{
+		std::unique_lock lock(mMutex);
+		return mStatistics;
+	}
+
+
+	bool EventQueue::MakeRoom(Event& event)
+	{
+		switch (mPolicy)
+		{
+			case OverflowPolicy::DropOldest:
+				mEvents.pop_front();
+				mStatistics.droppedOldest++;
+				return true;
+			case OverflowPolicy::DropNewest:
+				mStatistics.droppedNewest++;
+				return false;
+			case OverflowPolicy::CoalesceMotion:
+				// Fold incoming motion into queued motion at the back. The incoming event is consumed.
+				if (event.IsType<Events::MouseMove>() && mEvents.back().event.IsType<Events::MouseMove>())
+				{
+					MergeMotion(mEvents.back().event.Ref<Events::MouseMove>(), event.Ref<Events::MouseMove>());
+					mStatistics.coalesced++;
+					return false;
+				}
+				if (CoalesceQueued())
+				{
+					mStatistics.coalesced++;
+					return true;
+				}
+				if (DropQueuedHold())
+				{
+					mStatistics.droppedHold++;
+					return true;
+				}
+				mEvents.pop_front();
+				mStatistics.droppedOldest++;
+				return true;
+			case OverflowPolicy::Block:
+				// Backpressure is applied by PollInput() before dispatching, so events already dispatched are kept.
+				return true;
+			default:
+				Core::Unreachable();
+		}
+	}
+
+
+	void EventQueue::MergeMotion(Events::MouseMove& into, const Events::MouseMove& next)
+	{
+		into.position         = next.position;
+		into.deltaPosition[0] += next.deltaPosition[0];
+		into.deltaPosition[1] += next.deltaPosition[1];
+	}
+
+
+	bool EventQueue::CoalesceQueued()
+	{
+		// Fold the oldest pair of adjacent queued motion events together.
+		auto pair = std::ranges::adjacent_find(mEvents, [] (const Event& a, const Event& b)
+		{
+			return a.IsType<Events::MouseMove>() && b.IsType<Events::MouseMove>();
+		}, &TimedEvent::event);
+		if (pair != mEvents.end())
+		{
+			MergeMotion(pair->event.Ref<Events::MouseMove>(), std::next(pair)->event.Ref<Events::MouseMove>());
+			pair->timestamp = std::next(pair)->timestamp;
+			mEvents.erase(std::next(pair));
+			return true;
+		}
+
+		return false;
+	}
+
+
+	bool EventQueue::DropQueuedHold()
+	{
+		// Hold events are regenerated every poll, so the oldest one is the cheapest to lose.
+		auto hold = std::ranges::find_if(mEvents, [] (const Event& queued)
+		{
+			return queued.IsType<Events::Key>() && queued.Ref<Events::Key>().action == Input::KeyAction::Hold;
+		}, &TimedEvent::event);
+		if (hold != mEvents.end())
+		{
+			mEvents.erase(hold);
+			return true;
+		}
+
+		return false;
+	}
+}
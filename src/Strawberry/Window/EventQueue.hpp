@@ -0,0 +1,116 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Types/Optional.hpp"
+// Standard Library
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	enum class OverflowPolicy
+	{
+		// Discard the oldest queued event to make room.
+		DropOldest,
+		// Discard the incoming event.
+		DropNewest,
+		// Merge consecutive mouse motion, then discard key hold events, then fall back to DropOldest.
+		CoalesceMotion,
+		// Leave events with the window system while the queue is full: PollInput() stops dispatching events until a
+		// consumer makes room. Events dispatched by a single poll are all queued, so the queue may briefly exceed its
+		// capacity.
+		Block,
+	};
+
+
+	struct EventQueueStatistics
+	{
+		uint64_t droppedOldest = 0;
+		uint64_t droppedNewest = 0;
+		// Queued key hold events discarded by CoalesceMotion.
+		uint64_t droppedHold   = 0;
+		uint64_t coalesced     = 0;
+		// Polls deferred because the queue was full under OverflowPolicy::Block.
+		uint64_t blocked       = 0;
+	};
+
+
+	// Thread safe FIFO of events with an optional maximum size.
+	class EventQueue
+	{
+	public:
+		EventQueue() = default;
+		EventQueue(const EventQueue&)            = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+		EventQueue(EventQueue&& rhs) noexcept;
+		EventQueue& operator=(EventQueue&& rhs) noexcept;
+
+
+		// A capacity of 0 leaves the queue unbounded.
+		void           SetCapacity(size_t capacity, OverflowPolicy policy);
+		size_t         GetCapacity() const;
+		OverflowPolicy GetOverflowPolicy() const;
+
+
+		void                       Push(Event event, double timestamp);
+		Core::Optional<Event>      Pop();
+		Core::Optional<TimedEvent> PopTimed();
+
+
+		// Removes and returns the oldest event accepted by predicate.
+		template<std::predicate<const Event&> P>
+		Core::Optional<Event> PopIf(P&& predicate)
+		{
+			std::unique_lock lock(mMutex);
+
+			auto event = std::ranges::find_if(mEvents, std::forward<P>(predicate), &TimedEvent::event);
+			if (event == mEvents.end())
+			{
+				return {};
+			}
+
+			Event result(std::move(event->event));
+			mEvents.erase(event);
+			return result;
+		}
+
+		size_t Size() const;
+		bool   Empty() const;
+
+
+		// Returns true, and counts a blocked poll, while the queue is full under OverflowPolicy::Block.
+		bool BlockIfFull();
+
+
+		EventQueueStatistics GetStatistics() const;
+
+	private:
+		// Makes room for event according to mPolicy. Returns false if event should be discarded.
+		bool MakeRoom(Event& event);
+		// Frees one slot by merging two queued motion events. Returns false if there are none to merge.
+		bool CoalesceQueued();
+		// Frees one slot by removing the oldest queued key hold event. Returns false if none is queued.
+		bool DropQueuedHold();
+
+
+		static void MergeMotion(Events::MouseMove& into, const Events::MouseMove& next);
+
+
+		mutable std::mutex     mMutex;
+		std::deque<TimedEvent> mEvents;
+		size_t                 mCapacity = 0;
+		OverflowPolicy         mPolicy   = OverflowPolicy::DropOldest;
+		EventQueueStatistics   mStatistics;
+	};
+}
@@ -8,6 +8,7 @@
 namespace Strawberry::Window
 {
 	bool GLFWLibrary::sIsInitialised = false;
+	GLFWLibrary::Platform GLFWLibrary::sPlatform = Platform::Any;
 	std::atomic<unsigned> GLFWUser::sInstanceCount = 0;
 
 
@@ -17,11 +18,18 @@ namespace Strawberry::Window
 	}
 
 
+	void GLFWLibrary::SetPlatform(Platform platform) noexcept
+	{
+		sPlatform = platform;
+	}
+
+
 	void GLFWLibrary::Initialise() noexcept
 	{
 		Core::Assert(!sIsInitialised);
+		glfwInitHint(GLFW_PLATFORM, sPlatform == Platform::Null ? GLFW_PLATFORM_NULL : GLFW_ANY_PLATFORM);
 		Core::Assert(glfwInit() == GLFW_TRUE);
-		Core::Assert(glfwVulkanSupported());
+		Core::Assert(sPlatform == Platform::Null || glfwVulkanSupported());
 		GLFWLibrary::sIsInitialised = true;
 		glfwSetErrorCallback(&ErrorCallback);
 	}
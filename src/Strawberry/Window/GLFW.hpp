@@ -11,12 +11,24 @@ namespace Strawberry::Window
 		friend class GLFWUser;
 
 	public:
+		enum class Platform
+		{
+			Any,
+			// Headless platform without a display, for testing.
+			Null,
+		};
+
+
 		static bool IsInitialised() noexcept;
 
+		// Selects the platform used the next time the library is initialised.
+		static void SetPlatform(Platform platform) noexcept;
+
 	private:
 		static void Initialise() noexcept;
 		static void Terminate() noexcept;
 		static bool sIsInitialised;
+		static Platform sPlatform;
 
 		static void ErrorCallback(int, const char*);
 	};
@@ -0,0 +1,136 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "ActionMap.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+
+
+namespace Strawberry::Window::Input
+{
+	ActionContext& ActionContext::Bind(ActionID action, KeyCode key, Modifiers modifiers, KeyAction trigger)
+	{
+		mBindings.emplace_back(Binding
+		{
+			.input = static_cast<size_t>(key),
+			.modifiers = modifiers,
+			.trigger = trigger,
+			.action = action,
+		});
+		return *this;
+	}
+
+
+	ActionContext& ActionContext::Bind(ActionID action, MouseButton button, Modifiers modifiers, KeyAction trigger)
+	{
+		mBindings.emplace_back(Binding
+		{
+			.input = KeyCodeCount + static_cast<size_t>(button),
+			.modifiers = modifiers,
+			.trigger = trigger,
+			.action = action,
+		});
+		return *this;
+	}
+
+
+	ActionTable::ActionTable(const ActionContext& context)
+		: mSlots(SlotCount)
+		, mActions(context.mBindings.size())
+	{
+		ZoneScoped;
+
+		for (auto&& binding : context.mBindings)
+		{
+			Core::Assert(binding.modifiers < ModifierMaskCount);
+			mSlots[SlotIndex(binding.input, binding.modifiers, binding.trigger)].count++;
+		}
+
+		uint32_t offset = 0;
+		for (auto& slot : mSlots)
+		{
+			slot.offset = offset;
+			offset += slot.count;
+			slot.count = 0;
+		}
+
+		for (auto&& binding : context.mBindings)
+		{
+			Slot& slot = mSlots[SlotIndex(binding.input, binding.modifiers, binding.trigger)];
+			mActions[slot.offset + slot.count++] = binding.action;
+		}
+	}
+
+
+	std::span<const ActionID> ActionTable::Resolve(KeyCode key, Modifiers modifiers, KeyAction action) const noexcept
+	{
+		return Resolve(static_cast<size_t>(key), modifiers, action);
+	}
+
+
+	std::span<const ActionID> ActionTable::Resolve(MouseButton button, Modifiers modifiers, KeyAction action) const noexcept
+	{
+		return Resolve(KeyCodeCount + static_cast<size_t>(button), modifiers, action);
+	}
+
+
+	std::span<const ActionID> ActionTable::Resolve(const Event& event) const noexcept
+	{
+		if (event.IsType<Events::Key>())
+		{
+			const auto& key = event.Ref<Events::Key>();
+			return Resolve(key.keyCode, key.modifiers, key.action);
+		}
+
+		if (event.IsType<Events::MouseButton>())
+		{
+			const auto& button = event.Ref<Events::MouseButton>();
+			return Resolve(button.button, button.modifiers, button.action);
+		}
+
+		return {};
+	}
+
+
+	size_t ActionTable::SlotIndex(size_t input, Modifiers modifiers, KeyAction action) noexcept
+	{
+		return (input * ModifierMaskCount + (modifiers & (ModifierMaskCount - 1))) * KeyActionCount + static_cast<size_t>(action);
+	}
+
+
+	std::span<const ActionID> ActionTable::Resolve(size_t input, Modifiers modifiers, KeyAction action) const noexcept
+	{
+		if (mSlots.empty()) return {};
+
+		const Slot& slot = mSlots[SlotIndex(input, modifiers, action)];
+		return {mActions.data() + slot.offset, slot.count};
+	}
+
+
+	ActionMap::ContextID ActionMap::AddContext(const ActionContext& context)
+	{
+		mContexts.emplace_back(context);
+		return mContexts.size() - 1;
+	}
+
+
+	void ActionMap::SetActiveContext(ContextID context)
+	{
+		Core::Assert(context < mContexts.size());
+		mActiveContext = context;
+	}
+
+
+	ActionMap::ContextID ActionMap::GetActiveContext() const noexcept
+	{
+		return mActiveContext;
+	}
+
+
+	std::span<const ActionID> ActionMap::Resolve(const Event& event) const noexcept
+	{
+		if (mActiveContext >= mContexts.size()) return {};
+
+		return mContexts[mActiveContext].Resolve(event);
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+#include "Strawberry/Window/Input/Key.hpp"
+#include "Strawberry/Window/Input/Mouse.hpp"
+// Standard Library
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window::Input
+{
+	using ActionID = uint32_t;
+
+
+	// A declarative list of bindings from input chords to actions.
+	// Chords match modifiers exactly, so Ctrl+S and Ctrl+Shift+S may be bound to different actions.
+	class ActionContext
+	{
+		friend class ActionTable;
+
+	public:
+		ActionContext& Bind(ActionID action, KeyCode key, Modifiers modifiers = 0, KeyAction trigger = KeyAction::Press);
+		ActionContext& Bind(ActionID action, MouseButton button, Modifiers modifiers = 0, KeyAction trigger = KeyAction::Press);
+
+	private:
+		struct Binding
+		{
+			size_t    input;
+			Modifiers modifiers;
+			KeyAction trigger;
+			ActionID  action;
+		};
+
+
+		std::vector<Binding> mBindings;
+	};
+
+
+	// An ActionContext compiled into a dense [input][modifier-mask][trigger] table.
+	// Resolving an input to its actions is a single indexed load.
+	class ActionTable
+	{
+	public:
+		ActionTable() = default;
+		explicit ActionTable(const ActionContext& context);
+
+
+		std::span<const ActionID> Resolve(KeyCode key, Modifiers modifiers, KeyAction action) const noexcept;
+		std::span<const ActionID> Resolve(MouseButton button, Modifiers modifiers, KeyAction action) const noexcept;
+		std::span<const ActionID> Resolve(const Event& event) const noexcept;
+
+	private:
+		static constexpr size_t InputCount = KeyCodeCount + MouseButtonCount;
+		static constexpr size_t SlotCount  = InputCount * ModifierMaskCount * KeyActionCount;
+
+
+		static size_t SlotIndex(size_t input, Modifiers modifiers, KeyAction action) noexcept;
+		std::span<const ActionID> Resolve(size_t input, Modifiers modifiers, KeyAction action) const noexcept;
+
+
+		struct Slot
+		{
+			uint32_t offset = 0;
+			uint32_t count  = 0;
+		};
+
+
+		std::vector<Slot>     mSlots;
+		std::vector<ActionID> mActions;
+	};
+
+
+	// A set of compiled ActionTables, one per binding context.
+	// Switching the active context only swaps which table is consulted.
+	class ActionMap
+	{
+	public:
+		using ContextID = size_t;
+
+
+		ContextID AddContext(const ActionContext& context);
+
+		void      SetActiveContext(ContextID context);
+		ContextID GetActiveContext() const noexcept;
+
+
+		std::span<const ActionID> Resolve(const Event& event) const noexcept;
+
+	private:
+		std::vector<ActionTable> mContexts;
+		ContextID                mActiveContext = 0;
+	};
+}
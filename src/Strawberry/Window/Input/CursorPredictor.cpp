@@ -0,0 +1,85 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "CursorPredictor.hpp"
+// Standard Library
+#include <algorithm>
+
+
+namespace Strawberry::Window::Input
+{
+	CursorPredictor::CursorPredictor()
+		: CursorPredictor(Parameters{})
+	{}
+
+
+	CursorPredictor::CursorPredictor(Parameters parameters)
+		: mParameters(parameters)
+	{}
+
+
+	void CursorPredictor::AddSample(Core::Math::Vec2 position, double time)
+	{
+		const double dt = time - mLastSampleTime;
+
+		if (!mHasSample || dt <= 0.0 || dt > mParameters.maxSampleGap)
+		{
+			mPosition       = position;
+			mVelocity       = Core::Math::Vec2();
+			mLastSampleTime = time;
+			mHasSample      = true;
+			mHasPending     = false;
+			return;
+		}
+
+		if (dt < mParameters.minSampleInterval)
+		{
+			mPendingPosition = position;
+			mPendingTime     = time;
+			mHasPending      = true;
+			return;
+		}
+
+		for (int i = 0; i < 2; i++)
+		{
+			const double predicted = mPosition[i] + mVelocity[i] * dt;
+			const double residual  = position[i] - predicted;
+			mPosition[i] = predicted + mParameters.alpha * residual;
+			mVelocity[i] = mVelocity[i] + (mParameters.beta / dt) * residual;
+		}
+
+		mLastSampleTime = time;
+		mHasPending     = false;
+	}
+
+
+	void CursorPredictor::Reset()
+	{
+		mHasSample  = false;
+		mHasPending = false;
+	}
+
+
+	Core::Optional<Core::Math::Vec2> CursorPredictor::Predict(double targetTime) const
+	{
+		if (!mHasSample) return Core::NullOpt;
+
+		// Extrapolate from the most recent measurement, which may not have been through the filter yet.
+		const Core::Math::Vec2& position   = mHasPending ? mPendingPosition : mPosition;
+		const double            sampleTime = mHasPending ? mPendingTime : mLastSampleTime;
+		const double            gap        = targetTime - sampleTime;
+
+		// No samples for this long means the cursor has stopped, so the velocity is stale.
+		if (gap > mParameters.maxSampleGap) return position;
+
+		// Past the horizon the cursor has probably stopped, so the extrapolation fades out by the sample gap.
+		double horizon = std::clamp(gap, 0.0, mParameters.maxHorizon);
+		if (gap > mParameters.maxHorizon)
+		{
+			horizon *= (mParameters.maxSampleGap - gap) / (mParameters.maxSampleGap - mParameters.maxHorizon);
+		}
+
+		return Core::Math::Vec2(position[0] + mVelocity[0] * horizon,
+		                        position[1] + mVelocity[1] * horizon);
+	}
+}
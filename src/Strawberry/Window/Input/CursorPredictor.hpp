@@ -0,0 +1,61 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Core
+#include "Strawberry/Core/Math/Vector.hpp"
+#include "Strawberry/Core/Types/Optional.hpp"
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window::Input
+{
+	// Alpha-beta filter over timestamped cursor samples, used to extrapolate the cursor to a future presentation time.
+	// Times are in seconds on the GLFW timer.
+	class CursorPredictor
+	{
+	public:
+		struct Parameters
+		{
+			// Weight given to the measured position over the predicted one.
+			double alpha = 0.8;
+			// Weight given to the velocity correction.
+			double beta = 0.3;
+			// Samples further apart than this restart the filter with zero velocity. Predictions this far past the last
+			// sample hold its position.
+			double maxSampleGap = 0.1;
+			// Samples closer than this to the last filter update are merged into the next one. Samples dispatched by
+			// a single PollInput() are stamped microseconds apart, which would otherwise inflate the velocity.
+			double minSampleInterval = 0.004;
+			// Predictions are never extrapolated further than this past the last sample, and fade back to it between
+			// this and the sample gap.
+			double maxHorizon = 0.05;
+		};
+
+
+		CursorPredictor();
+		explicit CursorPredictor(Parameters parameters);
+
+
+		void AddSample(Core::Math::Vec2 position, double time);
+		void Reset();
+
+
+		Core::Optional<Core::Math::Vec2> Predict(double targetTime) const;
+
+	private:
+		Parameters mParameters;
+
+		Core::Math::Vec2 mPosition;
+		Core::Math::Vec2 mVelocity;
+		double           mLastSampleTime = 0.0;
+		bool             mHasSample      = false;
+
+		// Latest sample which arrived too soon after the last filter update.
+		Core::Math::Vec2 mPendingPosition;
+		double           mPendingTime = 0.0;
+		bool             mHasPending  = false;
+	};
+}
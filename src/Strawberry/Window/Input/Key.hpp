@@ -7,6 +7,7 @@
 // GLFW
 #include "GLFW/glfw3.h"
 // Standard Library
+#include <cstddef>
 #include <cstdint>
 
 
@@ -101,6 +102,9 @@ namespace Strawberry::Window::Input
 	};
 
 
+	inline constexpr size_t KeyCodeCount = static_cast<size_t>(KeyCode::F20) + 1;
+
+
 	Core::Optional<KeyCode> IntoKeyCode(int glfwKeyCode);
 
 
@@ -120,6 +124,9 @@ namespace Strawberry::Window::Input
 	};
 
 
+	inline constexpr size_t ModifierMaskCount = 1 << 4;
+
+
 	using ScanCode = int;
 
 
@@ -130,4 +137,7 @@ namespace Strawberry::Window::Input
 		Repeat,
 		Release,
 	};
+
+
+	inline constexpr size_t KeyActionCount = static_cast<size_t>(KeyAction::Release) + 1;
 }
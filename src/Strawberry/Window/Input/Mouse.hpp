@@ -2,6 +2,8 @@
 //======================================================================================================================
 //  Includes
 //----------------------------------------------------------------------------------------------------------------------
+// Standard Library
+#include <cstddef>
 
 
 //======================================================================================================================
@@ -15,4 +17,7 @@ namespace Strawberry::Window::Input
 		Middle,
 		Right,
 	};
+
+
+	inline constexpr size_t MouseButtonCount = static_cast<size_t>(MouseButton::Right) + 1;
 }
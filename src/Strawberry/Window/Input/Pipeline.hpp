@@ -0,0 +1,147 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+#include "Strawberry/Window/Input/Key.hpp"
+// Standard Library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <tuple>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window::Input
+{
+	// A pipeline stage may modify an event in place, and returns false to drop it.
+	template<typename T>
+	concept PipelineStage = requires(T stage, Event& event)
+	{
+		{ stage(event) } -> std::convertible_to<bool>;
+	};
+
+
+	// Runs a fixed sequence of stages over each event.
+	// The stage list is part of the type, so every stage call is resolved and inlined at compile time.
+	template<PipelineStage... Stages>
+	class Pipeline
+	{
+	public:
+		Pipeline() = default;
+
+
+		explicit Pipeline(Stages... stages) requires (sizeof...(Stages) > 0)
+			: mStages(std::move(stages)...)
+		{}
+
+
+		bool operator()(Event& event)
+		{
+			return std::apply([&event](auto&... stages) { return (static_cast<bool>(stages(event)) && ...); }, mStages);
+		}
+
+
+		template<typename Stage>
+		Stage& Get()
+		{
+			return std::get<Stage>(mStages);
+		}
+
+	private:
+		std::tuple<Stages...> mStages;
+	};
+
+
+	// Drops key repeat events.
+	struct DropRepeat
+	{
+		bool operator()(Event& event) const noexcept
+		{
+			return !event.IsType<Events::Key>() || event.Ref<Events::Key>().action != KeyAction::Repeat;
+		}
+	};
+
+
+	// Replaces key codes according to a remapping table. Unmapped keys pass through unchanged.
+	class Remap
+	{
+	public:
+		Remap() noexcept
+		{
+			for (size_t i = 0; i < KeyCodeCount; i++)
+			{
+				mMapping[i] = static_cast<KeyCode>(i);
+			}
+		}
+
+
+		Remap& Map(KeyCode from, KeyCode to) noexcept
+		{
+			mMapping[static_cast<size_t>(from)] = to;
+			return *this;
+		}
+
+
+		bool operator()(Event& event) const noexcept
+		{
+			if (event.IsType<Events::Key>())
+			{
+				auto& key = event.Ref<Events::Key>().keyCode;
+				key = mMapping[static_cast<size_t>(key)];
+			}
+
+			return true;
+		}
+
+	private:
+		std::array<KeyCode, KeyCodeCount> mMapping;
+	};
+
+
+	// Scales mouse motion deltas by a sensitivity, with an additional gain proportional to the speed of the motion.
+	struct MouseAccel
+	{
+		float sensitivity  = 1.0f;
+		float acceleration = 0.0f;
+
+
+		bool operator()(Event& event) const noexcept
+		{
+			if (event.IsType<Events::MouseMove>())
+			{
+				auto& delta = event.Ref<Events::MouseMove>().deltaPosition;
+				const float speed = std::hypot(delta[0], delta[1]);
+				const float gain  = sensitivity * (1.0f + acceleration * speed);
+				delta[0] *= gain;
+				delta[1] *= gain;
+			}
+
+			return true;
+		}
+	};
+
+
+	// Clamps each scroll axis to [-limit, limit].
+	struct ClampScroll
+	{
+		float limit = 1.0f;
+
+
+		bool operator()(Event& event) const noexcept
+		{
+			if (event.IsType<Events::MouseScroll>())
+			{
+				auto& scroll = event.Ref<Events::MouseScroll>().scroll;
+				scroll[0] = std::clamp(scroll[0], -limit, limit);
+				scroll[1] = std::clamp(scroll[1], -limit, limit);
+			}
+
+			return true;
+		}
+	};
+}
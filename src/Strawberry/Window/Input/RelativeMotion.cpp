@@ -0,0 +1,88 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "RelativeMotion.hpp"
+// Standard Library
+#include <algorithm>
+
+
+namespace Strawberry::Window::Input
+{
+	void RelativeMotionAccumulator::AddSample(Core::Math::Vec2 delta, double time)
+	{
+		// After a pause the first sample would otherwise cover ticks whose motion has already been taken.
+		const double start = mHasSample ? std::min(std::max(mLastSampleTime, mTakenUntil), time) : time;
+
+		mSamples.emplace_back(Sample{.delta = delta, .start = start, .end = time});
+		mLastSampleTime = time;
+		mHasSample      = true;
+
+		if (mSamples.size() > MaxSamples)
+		{
+			Sample& second = mSamples[1];
+			second.delta[0] += mSamples.front().delta[0];
+			second.delta[1] += mSamples.front().delta[1];
+			second.start     = mSamples.front().start;
+			mSamples.pop_front();
+		}
+	}
+
+
+	void RelativeMotionAccumulator::Reset()
+	{
+		mSamples.clear();
+		mHasSample  = false;
+		mTakenUntil = -std::numeric_limits<double>::infinity();
+	}
+
+
+	Core::Math::Vec2 RelativeMotionAccumulator::TakeDelta()
+	{
+		Core::Math::Vec2 total;
+		for (auto&& sample : mSamples)
+		{
+			total[0] += sample.delta[0];
+			total[1] += sample.delta[1];
+		}
+
+		mSamples.clear();
+		mTakenUntil = std::max(mTakenUntil, mLastSampleTime);
+		return total;
+	}
+
+
+	Core::Math::Vec2 RelativeMotionAccumulator::TakeDeltaUntil(double time)
+	{
+		Core::Math::Vec2 total;
+		mTakenUntil = std::max(mTakenUntil, time);
+
+		while (!mSamples.empty())
+		{
+			Sample& sample = mSamples.front();
+
+			if (sample.end <= time)
+			{
+				total[0] += sample.delta[0];
+				total[1] += sample.delta[1];
+				mSamples.pop_front();
+				continue;
+			}
+
+			if (sample.start < time)
+			{
+				const double fraction = (time - sample.start) / (sample.end - sample.start);
+				for (int i = 0; i < 2; i++)
+				{
+					const double part = sample.delta[i] * fraction;
+					total[i]        += part;
+					sample.delta[i] -= part;
+				}
+				sample.start = time;
+			}
+
+			break;
+		}
+
+		return total;
+	}
+}
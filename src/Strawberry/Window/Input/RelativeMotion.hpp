@@ -0,0 +1,51 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Core
+#include "Strawberry/Core/Math/Vector.hpp"
+// Standard Library
+#include <deque>
+#include <limits>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window::Input
+{
+	// Accumulates relative mouse motion in double precision, independent of absolute cursor coordinates.
+	// Each sample covers the time since the previous sample or the last Take, whichever is later, so motion can be split
+	// across fixed tick boundaries.
+	class RelativeMotionAccumulator
+	{
+	public:
+		void AddSample(Core::Math::Vec2 delta, double time);
+		void Reset();
+
+
+		// Returns all motion accumulated since the last Take.
+		Core::Math::Vec2 TakeDelta();
+		// Returns motion up to time, splitting a sample which straddles it in proportion to time.
+		Core::Math::Vec2 TakeDeltaUntil(double time);
+
+	private:
+		struct Sample
+		{
+			Core::Math::Vec2 delta;
+			double           start;
+			double           end;
+		};
+
+
+		// Beyond this many samples the oldest two are merged, so motion which is never taken cannot grow the queue.
+		static constexpr size_t MaxSamples = 1024;
+
+
+		std::deque<Sample> mSamples;
+		double             mLastSampleTime = 0.0;
+		bool               mHasSample      = false;
+		// Time up to which motion has been taken. No sample starts before it.
+		double             mTakenUntil     = -std::numeric_limits<double>::infinity();
+	};
+}
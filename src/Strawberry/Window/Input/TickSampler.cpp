@@ -0,0 +1,113 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "TickSampler.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Window.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <algorithm>
+
+
+namespace Strawberry::Window::Input
+{
+	Core::Optional<KeyAction> TickSampler::KeyState::GetAction() const noexcept
+	{
+		if (pressed) return KeyAction::Press;
+		if (released) return KeyAction::Release;
+		if (down) return KeyAction::Hold;
+		return Core::NullOpt;
+	}
+
+
+	const TickSampler::KeyState& TickSampler::Tick::GetKey(KeyCode key) const noexcept
+	{
+		return keys[static_cast<size_t>(key)];
+	}
+
+
+	TickSampler::TickSampler(double tickDuration, double startTime)
+		: mTickDuration(tickDuration)
+		, mStartTime(startTime)
+	{
+		Core::Assert(tickDuration > 0.0);
+	}
+
+
+	void TickSampler::Sample(Window& window)
+	{
+		ZoneScoped;
+
+		while (auto event = window.NextTimedEvent())
+		{
+			Add(event.Unwrap());
+		}
+	}
+
+
+	void TickSampler::Add(TimedEvent event)
+	{
+		// Hold events are regenerated once per poll, so they carry no timing information. Key state is rebuilt from
+		// presses and releases instead.
+		if (event.event.IsType<Events::Key>() && event.event.Ref<Events::Key>().action == KeyAction::Hold)
+		{
+			return;
+		}
+
+		auto position = std::ranges::upper_bound(mPending, event.timestamp, {}, &TimedEvent::timestamp);
+		mPending.insert(position, std::move(event));
+	}
+
+
+	Core::Optional<TickSampler::Tick> TickSampler::NextTick(double now)
+	{
+		ZoneScoped;
+
+		const double start = mStartTime + static_cast<double>(mNextTick) * mTickDuration;
+		const double end   = start + mTickDuration;
+		if (end > now) return Core::NullOpt;
+
+		Tick tick
+		{
+			.index = mNextTick++,
+			.start = start,
+			.end = end,
+			.events = {},
+			.keys = {},
+		};
+
+		// Events stamped before this tick's start arrived late, and are applied to the earliest tick still open.
+		while (!mPending.empty() && mPending.front().timestamp < end)
+		{
+			Event event = std::move(mPending.front().event);
+			mPending.pop_front();
+
+			if (event.IsType<Events::Key>())
+			{
+				const auto&  key   = event.Ref<Events::Key>();
+				const size_t index = static_cast<size_t>(key.keyCode);
+
+				if (key.action == KeyAction::Press)
+				{
+					tick.keys[index].pressed |= !mKeysDown[index];
+					mKeysDown[index]          = true;
+				}
+				else if (key.action == KeyAction::Release)
+				{
+					tick.keys[index].released |= mKeysDown[index];
+					mKeysDown[index]           = false;
+				}
+			}
+
+			tick.events.emplace_back(std::move(event));
+		}
+
+		for (size_t i = 0; i < KeyCodeCount; i++)
+		{
+			tick.keys[i].down = mKeysDown[i];
+		}
+
+		return tick;
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+#include "Strawberry/Window/Input/Key.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Types/Optional.hpp"
+// Standard Library
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+
+namespace Strawberry::Window
+{
+	class Window;
+}
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window::Input
+{
+	// Partitions timestamped events into fixed duration simulation ticks, independent of the frame rate.
+	// Times are in seconds on the GLFW timer. Events are stamped when PollInput() dispatches them, so ticks resolve
+	// input no finer than the polling interval. Polling more often than the tick rate keeps events in their own ticks.
+	class TickSampler
+	{
+	public:
+		struct KeyState
+		{
+			// Whether the key is down at the end of the tick.
+			bool down     = false;
+			// Whether the key went down or up at any point during the tick. A tap within one tick sets both.
+			bool pressed  = false;
+			bool released = false;
+
+
+			// Press or Release if the key changed during the tick, Hold if it was held throughout.
+			Core::Optional<KeyAction> GetAction() const noexcept;
+		};
+
+
+		struct Tick
+		{
+			uint64_t           index;
+			double             start;
+			double             end;
+			std::vector<Event> events;
+
+			std::array<KeyState, KeyCodeCount> keys;
+
+
+			const KeyState& GetKey(KeyCode key) const noexcept;
+		};
+
+
+		TickSampler(double tickDuration, double startTime);
+
+
+		// Takes every queued event from the window.
+		void Sample(Window& window);
+		void Add(TimedEvent event);
+
+
+		// Returns the next tick which has ended by now, if any. Call repeatedly to catch up after a long frame.
+		Core::Optional<Tick> NextTick(double now);
+
+	private:
+		double                    mTickDuration;
+		double                    mStartTime;
+		uint64_t                  mNextTick = 0;
+		std::deque<TimedEvent>    mPending;
+		std::bitset<KeyCodeCount> mKeysDown;
+	};
+}
@@ -16,6 +16,17 @@ namespace Strawberry::Window
 	}
 
 
+	static VideoMode IntoVideoMode(const GLFWvidmode& mode)
+	{
+		return VideoMode
+		{
+			.mResolution = Core::Math::Vec2u(mode.width, mode.height),
+			.mRefreshRate = static_cast<unsigned int>(mode.refreshRate),
+			.mBitsPerPixel = static_cast<unsigned int>(mode.redBits + mode.greenBits + mode.blueBits),
+		};
+	}
+
+
 	std::vector<MonitorInfo> GetMonitorInfo()
 	{
 		GLFWUser libraryUser;
@@ -30,10 +41,21 @@ namespace Strawberry::Window
 				int widthMM = 0, heightMM = 0;
 				glfwGetMonitorPhysicalSize(monitor, &widthMM, &heightMM);
 
+				int videoModeCount = 0;
+				const GLFWvidmode* videoModes = glfwGetVideoModes(monitor, &videoModeCount);
+
+				const char* name = glfwGetMonitorName(monitor);
+
 				return MonitorInfo
 				{
+					.mHandle = monitor,
+					.mName = name ? name : "",
 					.mResolution = Core::Math::Vec2u(videoMode->width, videoMode->height),
 					.mPhysicalSizeMM = Core::Math::Vec2u(widthMM, heightMM),
+					.mCurrentVideoMode = IntoVideoMode(*videoMode),
+					.mVideoModes = std::ranges::views::counted(videoModes, videoModeCount)
+						| std::views::transform(IntoVideoMode)
+						| std::ranges::to<std::vector>(),
 				};
 			})
 			| std::ranges::to<std::vector>();
@@ -6,16 +6,41 @@
 // Strawberry Core
 #include "Strawberry/Core/Math/Vector.hpp"
 // Standard Library
+#include <string>
 #include <vector>
 
 
+struct GLFWmonitor;
+
+
 namespace Strawberry::Window
 {
+	struct VideoMode
+	{
+		Core::Math::Vec2u mResolution;
+		unsigned int      mRefreshRate;
+		unsigned int      mBitsPerPixel;
+
+
+		bool operator==(const VideoMode& rhs) const noexcept
+		{
+			return mResolution[0] == rhs.mResolution[0]
+				&& mResolution[1] == rhs.mResolution[1]
+				&& mRefreshRate == rhs.mRefreshRate
+				&& mBitsPerPixel == rhs.mBitsPerPixel;
+		}
+	};
+
+
 	struct MonitorInfo
 		: GLFWUser
 	{
-		Core::Math::Vec2u mResolution;
-		Core::Math::Vec2u mPhysicalSizeMM;
+		GLFWmonitor*           mHandle;
+		std::string            mName;
+		Core::Math::Vec2u      mResolution;
+		Core::Math::Vec2u      mPhysicalSizeMM;
+		VideoMode              mCurrentVideoMode;
+		std::vector<VideoMode> mVideoModes;
 
 
 		Core::Math::Vec2f GetDPI() const noexcept;
@@ -0,0 +1,80 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "PowerGovernor.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Window.hpp"
+// GLFW3
+#include "GLFW/glfw3.h"
+// Standard Library
+#include <thread>
+
+
+namespace Strawberry::Window
+{
+	bool                                  PowerGovernor::sEnabled = false;
+	PowerGovernor::Config                 PowerGovernor::sConfig;
+	std::chrono::steady_clock::time_point PowerGovernor::sLastFrame;
+
+
+	void PowerGovernor::Enable()
+	{
+		Enable(Config{});
+	}
+
+
+	void PowerGovernor::Enable(Config config)
+	{
+		sConfig    = config;
+		sEnabled   = true;
+		sLastFrame = std::chrono::steady_clock::now();
+	}
+
+
+	void PowerGovernor::Disable()
+	{
+		sEnabled = false;
+	}
+
+
+	bool PowerGovernor::IsEnabled() noexcept
+	{
+		return sEnabled;
+	}
+
+
+	bool PowerGovernor::IsIdle()
+	{
+		return sEnabled && !Window::IsAnyWindowActive();
+	}
+
+
+	void PowerGovernor::PaceFrame()
+	{
+		ZoneScoped;
+
+		if (!sEnabled) return;
+
+		if (!IsIdle() && sConfig.activeFrameInterval.count() > 0)
+		{
+			std::this_thread::sleep_until(sLastFrame + std::chrono::duration_cast<std::chrono::steady_clock::duration>(sConfig.activeFrameInterval));
+		}
+
+		sLastFrame = std::chrono::steady_clock::now();
+	}
+
+
+	void PowerGovernor::WaitForInput()
+	{
+		ZoneScoped;
+
+		if (IsIdle())
+		{
+			glfwWaitEventsTimeout(sConfig.idlePollTimeout.count());
+		}
+		else
+		{
+			glfwPollEvents();
+		}
+	}
+}
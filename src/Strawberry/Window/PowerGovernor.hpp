@@ -0,0 +1,54 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Standard Library
+#include <chrono>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	// Opt-in throttling of input polling and frame pacing while no window is active.
+	// A window is active when it is visible, not iconified and has focus.
+	// While idle, PollInput() waits for events instead of polling, so activity resumes on the first event received.
+	class PowerGovernor
+	{
+		friend class Window;
+
+	public:
+		struct Config
+		{
+			// Longest PollInput() waits for events while idle. This bounds the idle frame rate.
+			std::chrono::duration<double> idlePollTimeout = std::chrono::milliseconds(100);
+			// Minimum frame interval enforced by PaceFrame() while active. Zero disables pacing.
+			std::chrono::duration<double> activeFrameInterval{0};
+		};
+
+
+		static void Enable();
+		static void Enable(Config config);
+		static void Disable();
+		static bool IsEnabled() noexcept;
+
+
+		// True while the governor is enabled and no window is active.
+		static bool IsIdle();
+
+
+		// Call once per frame. While active, sleeps out the remainder of the frame interval. While idle, returns
+		// immediately, as the next PollInput() waits for events instead. Events are only ever dispatched by PollInput().
+		static void PaceFrame();
+
+	private:
+		// Polls for events when active, or waits for them when idle.
+		static void WaitForInput();
+
+
+		static bool                                  sEnabled;
+		static Config                                sConfig;
+		static std::chrono::steady_clock::time_point sLastFrame;
+	};
+}
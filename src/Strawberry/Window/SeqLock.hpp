@@ -0,0 +1,86 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Standard Library
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	// Single-writer sequence lock.
+	// The writer never waits, and readers on any thread retry until they observe a consistent copy. The value is held
+	// as words accessed through relaxed atomics, so a reader racing the writer sees a torn copy, never a data race.
+	template<typename T> requires (std::is_trivially_copyable_v<T>)
+	class SeqLock
+	{
+		static constexpr size_t WordCount = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+
+		using Words = std::array<uint64_t, WordCount>;
+
+	public:
+		SeqLock()
+			: SeqLock(T{})
+		{}
+
+
+		explicit SeqLock(const T& value)
+		{
+			std::memcpy(mWords.data(), &value, sizeof(T));
+		}
+
+
+		void Store(const T& value) noexcept
+		{
+			Words words{};
+			std::memcpy(words.data(), &value, sizeof(T));
+
+			const uint64_t sequence = mSequence.load(std::memory_order_relaxed);
+			mSequence.store(sequence + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			for (size_t i = 0; i < WordCount; i++)
+			{
+				std::atomic_ref(mWords[i]).store(words[i], std::memory_order_relaxed);
+			}
+			mSequence.store(sequence + 2, std::memory_order_release);
+		}
+
+
+		T Load() const noexcept
+		{
+			Words    words;
+			uint64_t before, after;
+
+			do
+			{
+				before = mSequence.load(std::memory_order_acquire);
+				for (size_t i = 0; i < WordCount; i++)
+				{
+					words[i] = std::atomic_ref(mWords[i]).load(std::memory_order_relaxed);
+				}
+				std::atomic_thread_fence(std::memory_order_acquire);
+				after = mSequence.load(std::memory_order_relaxed);
+			}
+			while ((before & 1) != 0 || before != after);
+
+			std::array<std::byte, sizeof(T)> bytes;
+			std::memcpy(bytes.data(), words.data(), sizeof(T));
+			return std::bit_cast<T>(bytes);
+		}
+
+	private:
+		std::atomic<uint64_t> mSequence = 0;
+		// Mutable so that Load() can read it through std::atomic_ref.
+		alignas(std::atomic_ref<uint64_t>::required_alignment) mutable Words mWords{};
+	};
+}
@@ -0,0 +1,437 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "SharedEventChannel.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <utility>
+// POSIX
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define STRAWBERRY_WINDOW_SHARED_MEMORY
+#endif
+
+
+namespace Strawberry::Window
+{
+	namespace
+	{
+		std::string NormaliseName(const std::string& name)
+		{
+			return name.starts_with('/') ? name : "/" + name;
+		}
+
+
+		size_t MappingSize(uint32_t capacity)
+		{
+			return sizeof(SharedEventChannelHeader) + 2 * static_cast<size_t>(capacity) * sizeof(SharedEventSlot);
+		}
+	}
+
+
+	Core::Optional<EventRecord> IntoEventRecord(const Event& event, double timestamp)
+	{
+		EventRecord record{};
+		record.timestamp = timestamp;
+
+		if (event.IsType<Events::Key>())
+		{
+			const auto& key  = event.Ref<Events::Key>();
+			record.type      = EventRecord::Type::Key;
+			record.code      = static_cast<uint32_t>(key.keyCode);
+			record.scanCode  = key.scanCode;
+			record.modifiers = key.modifiers;
+			record.action    = static_cast<uint8_t>(key.action);
+		}
+		else if (event.IsType<Events::Text>())
+		{
+			record.type = EventRecord::Type::Text;
+			record.code = static_cast<uint32_t>(event.Ref<Events::Text>().codepoint);
+		}
+		else if (event.IsType<Events::MouseMove>())
+		{
+			const auto& move = event.Ref<Events::MouseMove>();
+			record.type      = EventRecord::Type::MouseMove;
+			record.x         = move.position[0];
+			record.y         = move.position[1];
+			record.dx        = move.deltaPosition[0];
+			record.dy        = move.deltaPosition[1];
+		}
+		else if (event.IsType<Events::MouseButton>())
+		{
+			const auto& button = event.Ref<Events::MouseButton>();
+			record.type        = EventRecord::Type::MouseButton;
+			record.code        = static_cast<uint32_t>(button.button);
+			record.modifiers   = button.modifiers;
+			record.action      = static_cast<uint8_t>(button.action);
+			record.x           = button.position[0];
+			record.y           = button.position[1];
+		}
+		else if (event.IsType<Events::MouseScroll>())
+		{
+			const auto& scroll = event.Ref<Events::MouseScroll>();
+			record.type        = EventRecord::Type::MouseScroll;
+			record.x           = scroll.scroll[0];
+			record.y           = scroll.scroll[1];
+		}
+		else if (event.IsType<Events::Focus>())
+		{
+			record.type = EventRecord::Type::Focus;
+			record.code = event.Ref<Events::Focus>().focussed ? 1 : 0;
+		}
+		else
+		{
+			return Core::NullOpt;
+		}
+
+		return record;
+	}
+
+
+	Core::Optional<Event> IntoEvent(const EventRecord& record)
+	{
+		switch (record.type)
+		{
+			case EventRecord::Type::Key:
+				if (record.code >= Input::KeyCodeCount || record.action >= Input::KeyActionCount) return Core::NullOpt;
+				return Event(Events::Key
+				{
+					.keyCode = static_cast<Input::KeyCode>(record.code),
+					.scanCode = record.scanCode,
+					.modifiers = record.modifiers,
+					.action = static_cast<Input::KeyAction>(record.action),
+				});
+			case EventRecord::Type::Text:
+				return Event(Events::Text{.codepoint = static_cast<char32_t>(record.code)});
+			case EventRecord::Type::MouseMove:
+				return Event(Events::MouseMove
+				{
+					.position = Core::Math::Vec2f(record.x, record.y),
+					.deltaPosition = Core::Math::Vec2f(record.dx, record.dy),
+				});
+			case EventRecord::Type::MouseButton:
+				if (record.code >= Input::MouseButtonCount || record.action >= Input::KeyActionCount) return Core::NullOpt;
+				return Event(Events::MouseButton
+				{
+					.button = static_cast<Input::MouseButton>(record.code),
+					.modifiers = record.modifiers,
+					.action = static_cast<Input::KeyAction>(record.action),
+					.position = Core::Math::Vec2f(record.x, record.y),
+				});
+			case EventRecord::Type::MouseScroll:
+				return Event(Events::MouseScroll{.scroll = Core::Math::Vec2f(record.x, record.y)});
+			case EventRecord::Type::Focus:
+				return Event(Events::Focus{.focussed = record.code != 0});
+			default:
+				return Core::NullOpt;
+		}
+	}
+
+
+	SharedEventMapping::SharedEventMapping(std::string name, void* address, size_t size, bool owner)
+		: mName(std::move(name))
+		, mAddress(address)
+		, mSize(size)
+		, mOwner(owner)
+	{}
+
+
+	SharedEventMapping::SharedEventMapping(SharedEventMapping&& rhs) noexcept
+		: mName(std::move(rhs.mName))
+		, mAddress(std::exchange(rhs.mAddress, nullptr))
+		, mSize(std::exchange(rhs.mSize, 0))
+		, mOwner(std::exchange(rhs.mOwner, false))
+	{}
+
+
+	SharedEventMapping& SharedEventMapping::operator=(SharedEventMapping&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			std::destroy_at(this);
+			std::construct_at(this, std::move(rhs));
+		}
+
+		return *this;
+	}
+
+
+	SharedEventMapping::~SharedEventMapping()
+	{
+#ifdef STRAWBERRY_WINDOW_SHARED_MEMORY
+		if (mAddress)
+		{
+			munmap(mAddress, mSize);
+			if (mOwner) shm_unlink(mName.c_str());
+		}
+#endif
+	}
+
+
+	const std::string& SharedEventMapping::GetName() const noexcept
+	{
+		return mName;
+	}
+
+
+	Core::Optional<SharedEventMapping> SharedEventMapping::Create(const std::string& name, uint32_t capacity)
+	{
+		ZoneScoped;
+
+#ifdef STRAWBERRY_WINDOW_SHARED_MEMORY
+		const std::string normalisedName = NormaliseName(name);
+		capacity = std::bit_ceil(std::max<uint32_t>(capacity, 2));
+		const size_t size = MappingSize(capacity);
+
+		// Never take over a live channel, whose peers would fault on the truncated mapping.
+		const int file = shm_open(normalisedName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (file < 0) return Core::NullOpt;
+
+		if (ftruncate(file, static_cast<off_t>(size)) != 0)
+		{
+			close(file);
+			shm_unlink(normalisedName.c_str());
+			return Core::NullOpt;
+		}
+
+		void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+		close(file);
+		if (address == MAP_FAILED)
+		{
+			shm_unlink(normalisedName.c_str());
+			return Core::NullOpt;
+		}
+
+		auto* header = std::construct_at(static_cast<SharedEventChannelHeader*>(address));
+		header->capacity   = capacity;
+		header->recordSize = sizeof(EventRecord);
+		header->version    = SharedEventChannelHeader::Version;
+		header->publishHead.store(0, std::memory_order_relaxed);
+		header->injectHead.store(0, std::memory_order_relaxed);
+		header->injectTail.store(0, std::memory_order_relaxed);
+
+		auto* slots = reinterpret_cast<SharedEventSlot*>(header + 1);
+		for (size_t i = 0; i < 2 * static_cast<size_t>(capacity); i++)
+		{
+			std::construct_at(slots + i)->sequence.store(0, std::memory_order_relaxed);
+		}
+
+		std::atomic_thread_fence(std::memory_order_release);
+		header->magic = SharedEventChannelHeader::Magic;
+
+		return SharedEventMapping(normalisedName, address, size, true);
+#else
+		return Core::NullOpt;
+#endif
+	}
+
+
+	Core::Optional<SharedEventMapping> SharedEventMapping::Open(const std::string& name)
+	{
+		ZoneScoped;
+
+#ifdef STRAWBERRY_WINDOW_SHARED_MEMORY
+		const std::string normalisedName = NormaliseName(name);
+
+		const int file = shm_open(normalisedName.c_str(), O_RDWR, 0);
+		if (file < 0) return Core::NullOpt;
+
+		struct stat status{};
+		if (fstat(file, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(SharedEventChannelHeader))
+		{
+			close(file);
+			return Core::NullOpt;
+		}
+
+		const size_t size    = static_cast<size_t>(status.st_size);
+		void*        address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+		close(file);
+		if (address == MAP_FAILED) return Core::NullOpt;
+
+		SharedEventMapping mapping(normalisedName, address, size, false);
+
+		const auto& header = mapping.Header();
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (header.magic != SharedEventChannelHeader::Magic
+			|| header.version != SharedEventChannelHeader::Version
+			|| header.recordSize != sizeof(EventRecord)
+			|| !std::has_single_bit(header.capacity)
+			|| MappingSize(header.capacity) != size)
+		{
+			return Core::NullOpt;
+		}
+
+		return mapping;
+#else
+		return Core::NullOpt;
+#endif
+	}
+
+
+	SharedEventChannelHeader& SharedEventMapping::Header() const noexcept
+	{
+		return *static_cast<SharedEventChannelHeader*>(mAddress);
+	}
+
+
+	SharedEventSlot& SharedEventMapping::PublishedSlot(uint64_t index) const noexcept
+	{
+		auto* slots = reinterpret_cast<SharedEventSlot*>(&Header() + 1);
+		return slots[index & (Header().capacity - 1)];
+	}
+
+
+	SharedEventSlot& SharedEventMapping::InjectedSlot(uint64_t index) const noexcept
+	{
+		auto* slots = reinterpret_cast<SharedEventSlot*>(&Header() + 1) + Header().capacity;
+		return slots[index & (Header().capacity - 1)];
+	}
+
+
+	Core::Optional<SharedEventChannel> SharedEventChannel::Create(const std::string& name, uint32_t capacity)
+	{
+		auto mapping = SharedEventMapping::Create(name, capacity);
+		if (!mapping) return Core::NullOpt;
+		return SharedEventChannel(mapping.Unwrap());
+	}
+
+
+	SharedEventChannel::SharedEventChannel(SharedEventMapping&& mapping)
+		: SharedEventMapping(std::move(mapping))
+	{}
+
+
+	void SharedEventChannel::Publish(const EventRecord& record) noexcept
+	{
+		auto&            header = Header();
+		const uint64_t   index  = header.publishHead.load(std::memory_order_relaxed);
+		SharedEventSlot& slot   = PublishedSlot(index);
+
+		slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		std::memcpy(&slot.record, &record, sizeof(EventRecord));
+		slot.sequence.store(2 * index + 2, std::memory_order_release);
+		header.publishHead.store(index + 1, std::memory_order_release);
+	}
+
+
+	Core::Optional<SharedEventReader> SharedEventReader::Open(const std::string& name)
+	{
+		auto mapping = SharedEventMapping::Open(name);
+		if (!mapping) return Core::NullOpt;
+		return SharedEventReader(mapping.Unwrap());
+	}
+
+
+	SharedEventReader::SharedEventReader(SharedEventMapping&& mapping)
+		: SharedEventMapping(std::move(mapping))
+		, mCursor(Header().publishHead.load(std::memory_order_acquire))
+	{}
+
+
+	const EventRecord* SharedEventReader::Peek() noexcept
+	{
+		const auto& header = Header();
+
+		while (true)
+		{
+			const uint64_t head = header.publishHead.load(std::memory_order_acquire);
+			if (mCursor >= head) return nullptr;
+
+			if (head - mCursor > header.capacity)
+			{
+				mLostCount += head - header.capacity - mCursor;
+				mCursor     = head - header.capacity;
+			}
+
+			const SharedEventSlot& slot = PublishedSlot(mCursor);
+			mSequence = slot.sequence.load(std::memory_order_acquire);
+			if (mSequence == 2 * mCursor + 2)
+			{
+				return &slot.record;
+			}
+
+			// The producer has already lapped this slot.
+			mLostCount++;
+			mCursor++;
+		}
+	}
+
+
+	bool SharedEventReader::Advance() noexcept
+	{
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const bool intact = PublishedSlot(mCursor).sequence.load(std::memory_order_relaxed) == mSequence;
+		if (!intact) mLostCount++;
+		mCursor++;
+		return intact;
+	}
+
+
+	Core::Optional<EventRecord> SharedEventReader::Read() noexcept
+	{
+		while (const EventRecord* record = Peek())
+		{
+			EventRecord copy;
+			std::memcpy(&copy, record, sizeof(EventRecord));
+			if (Advance()) return copy;
+		}
+
+		return Core::NullOpt;
+	}
+
+
+	uint64_t SharedEventReader::GetLostCount() const noexcept
+	{
+		return mLostCount;
+	}
+
+
+	Core::Optional<SharedEventInjector> SharedEventInjector::Open(const std::string& name)
+	{
+		auto mapping = SharedEventMapping::Open(name);
+		if (!mapping) return Core::NullOpt;
+		return SharedEventInjector(mapping.Unwrap());
+	}
+
+
+	SharedEventInjector::SharedEventInjector(SharedEventMapping&& mapping)
+		: SharedEventMapping(std::move(mapping))
+	{}
+
+
+	bool SharedEventInjector::Inject(const EventRecord& record) noexcept
+	{
+		auto&    header = Header();
+		uint64_t head   = header.injectHead.load(std::memory_order_relaxed);
+
+		do
+		{
+			if (head - header.injectTail.load(std::memory_order_acquire) >= header.capacity)
+			{
+				return false;
+			}
+		}
+		while (!header.injectHead.compare_exchange_weak(head, head + 1, std::memory_order_relaxed));
+
+		SharedEventSlot& slot = InjectedSlot(head);
+		std::memcpy(&slot.record, &record, sizeof(EventRecord));
+		slot.record.flags |= EventRecord::Injected;
+		slot.sequence.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	bool SharedEventInjector::Inject(const Event& event, double timestamp) noexcept
+	{
+		auto record = IntoEventRecord(event, timestamp);
+		return record && Inject(*record);
+	}
+}
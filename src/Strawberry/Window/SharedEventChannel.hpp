@@ -0,0 +1,233 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Types/Optional.hpp"
+// Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+
+//======================================================================================================================
+//  Shared Memory Layout
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  A channel is a named POSIX shared memory object laid out as:
+//
+//      SharedEventChannelHeader                        (256 bytes)
+//      SharedEventSlot published[capacity]             (window -> readers)
+//      SharedEventSlot injected[capacity]              (injectors -> window)
+//
+//  The published ring has a single producer (the window) and any number of readers, each with its own cursor.
+//  The producer never waits. Readers that fall a full ring behind skip ahead and count the records they lost.
+//  A published slot holding record i has sequence 2i + 2, and an odd sequence while it is being written.
+//
+//  The injected ring is a bounded multi-producer, single consumer queue drained by the window during PollInput().
+//  An injected slot holding record i has sequence i + 1.
+//
+//  Only events with an EventRecord::Type are published. Drop events carry any number of paths and never are.
+//
+//  Injected records are dispatched by the poll which drains them. They bypass the window's input pipeline, and do not
+//  update its cursor position, relative motion or published state. They are republished unchanged, with the
+//  injector's timestamp, but queued with the time of the poll which drained them, as the injector's clock is not the
+//  window's.
+//
+//  All multi-byte fields are in the host's native byte order.
+//
+namespace Strawberry::Window
+{
+	struct EventRecord
+	{
+		enum class Type : uint32_t
+		{
+			None = 0,
+			Key,
+			Text,
+			MouseMove,
+			MouseButton,
+			MouseScroll,
+			Focus,
+		};
+
+
+		enum Flags : uint32_t
+		{
+			// The record was written by an injector rather than produced by the window system.
+			Injected = 1 << 0,
+		};
+
+
+		Type     type;
+		uint32_t flags;
+		// Key: Input::KeyCode. MouseButton: Input::MouseButton. Text: codepoint. Focus: 1 if focussed.
+		uint32_t code;
+		// Key: Input::ScanCode.
+		int32_t  scanCode;
+		// Key, MouseButton: Input::Modifiers and Input::KeyAction.
+		uint8_t  modifiers;
+		uint8_t  action;
+		uint8_t  reserved0[6];
+		// Seconds on the publishing process's GLFW timer.
+		double   timestamp;
+		// MouseMove, MouseButton: position. MouseScroll: scroll offset.
+		double   x;
+		double   y;
+		// MouseMove: delta position.
+		double   dx;
+		double   dy;
+	};
+	static_assert(sizeof(EventRecord) == 64);
+	static_assert(std::is_trivially_copyable_v<EventRecord>);
+
+
+	struct alignas(64) SharedEventSlot
+	{
+		std::atomic<uint64_t> sequence;
+		EventRecord           record;
+	};
+	static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+
+	struct alignas(64) SharedEventChannelHeader
+	{
+		static constexpr uint32_t Magic   = 0x53574556; // 'SWEV'
+		static constexpr uint32_t Version = 1;
+
+
+		uint32_t magic;
+		uint32_t version;
+		uint32_t capacity;
+		uint32_t recordSize;
+
+		alignas(64) std::atomic<uint64_t> publishHead;
+		alignas(64) std::atomic<uint64_t> injectHead;
+		alignas(64) std::atomic<uint64_t> injectTail;
+	};
+	static_assert(sizeof(SharedEventChannelHeader) == 256);
+
+
+	Core::Optional<EventRecord> IntoEventRecord(const Event& event, double timestamp);
+	Core::Optional<Event>       IntoEvent(const EventRecord& record);
+
+
+	//======================================================================================================================
+	//  Class Declaration
+	//----------------------------------------------------------------------------------------------------------------------
+	// Common mapping of a channel's shared memory object.
+	class SharedEventMapping
+	{
+	public:
+		SharedEventMapping(const SharedEventMapping&)            = delete;
+		SharedEventMapping& operator=(const SharedEventMapping&) = delete;
+		SharedEventMapping(SharedEventMapping&& rhs) noexcept;
+		SharedEventMapping& operator=(SharedEventMapping&& rhs) noexcept;
+		~SharedEventMapping();
+
+
+		const std::string& GetName() const noexcept;
+
+	protected:
+		SharedEventMapping(std::string name, void* address, size_t size, bool owner);
+
+		static Core::Optional<SharedEventMapping> Create(const std::string& name, uint32_t capacity);
+		static Core::Optional<SharedEventMapping> Open(const std::string& name);
+
+
+		SharedEventChannelHeader& Header() const noexcept;
+		SharedEventSlot&          PublishedSlot(uint64_t index) const noexcept;
+		SharedEventSlot&          InjectedSlot(uint64_t index) const noexcept;
+
+	private:
+		std::string mName;
+		void*       mAddress = nullptr;
+		size_t      mSize    = 0;
+		bool        mOwner   = false;
+	};
+
+
+	// The window side of a channel. Creates and owns the shared memory object.
+	class SharedEventChannel
+		: public SharedEventMapping
+	{
+	public:
+		// Capacity is rounded up to a power of two. Fails if a channel with the same name already exists.
+		static Core::Optional<SharedEventChannel> Create(const std::string& name, uint32_t capacity);
+
+
+		void Publish(const EventRecord& record) noexcept;
+
+
+		// Calls function with each record written by injectors since the last call.
+		template<typename F>
+		void DrainInjected(F&& function)
+		{
+			auto&    header = Header();
+			uint64_t tail   = header.injectTail.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				SharedEventSlot& slot = InjectedSlot(tail);
+				if (slot.sequence.load(std::memory_order_acquire) != tail + 1) break;
+
+				const EventRecord record = slot.record;
+				header.injectTail.store(++tail, std::memory_order_release);
+				function(record);
+			}
+		}
+
+	private:
+		explicit SharedEventChannel(SharedEventMapping&& mapping);
+	};
+
+
+	// Reads the published stream of a channel, in this or another process.
+	class SharedEventReader
+		: public SharedEventMapping
+	{
+	public:
+		// Starts reading from the newest record.
+		static Core::Optional<SharedEventReader> Open(const std::string& name);
+
+
+		// Returns the next record in place in shared memory, or nullptr if there are none.
+		const EventRecord* Peek() noexcept;
+		// Releases the record returned by Peek(). Returns false if the producer overwrote it while it was being read.
+		bool               Advance() noexcept;
+		// Copies out the next intact record.
+		Core::Optional<EventRecord> Read() noexcept;
+
+
+		uint64_t GetLostCount() const noexcept;
+
+	private:
+		explicit SharedEventReader(SharedEventMapping&& mapping);
+
+
+		uint64_t mCursor    = 0;
+		uint64_t mSequence  = 0;
+		uint64_t mLostCount = 0;
+	};
+
+
+	// Writes records into a channel's injected ring, in this or another process.
+	class SharedEventInjector
+		: public SharedEventMapping
+	{
+	public:
+		static Core::Optional<SharedEventInjector> Open(const std::string& name);
+
+
+		// Returns false if the injected ring is full.
+		bool Inject(const EventRecord& record) noexcept;
+		bool Inject(const Event& event, double timestamp = 0.0) noexcept;
+
+	private:
+		explicit SharedEventInjector(SharedEventMapping&& mapping);
+	};
+}
@@ -2,33 +2,76 @@
 //  Includes
 //----------------------------------------------------------------------------------------------------------------------
 #include "Window.hpp"
+// Strawberry Window
+#include "Strawberry/Window/PowerGovernor.hpp"
 // Strawberry Core
 #include "Strawberry/Core/Assert.hpp"
 // GLFW3
 #include "GLFW/glfw3.h"
 #include "Strawberry/Core/IO/DynamicByteBuffer.hpp"
+// Standard Library
+#include <algorithm>
+#include <ranges>
 
 
 namespace Strawberry::Window
 {
 	Core::Mutex<std::map<GLFWwindow*, Window*>> Window::sInstanceMap;
+	std::deque<Window::ReadyCoroutine>          Window::sReadyCoroutines;
 
 
 	Window::Window(const std::string& title, Core::Math::Vec2i size)
-		: mTitle(title)
+		: Window(WindowConfig(title, size))
+	{}
+
+
+	Window::Window(const WindowConfig& config)
+		: mCommandQueue(std::make_unique<WindowCommandQueue>())
+		, mTitle(config.title)
 	{	ZoneScoped;
-		Core::Assert(size[0] > 0 && size[1] > 0);
+		Core::Assert(config.size[0] > 0 && config.size[1] > 0);
+
+		auto Hint = [] (bool value) { return value ? GLFW_TRUE : GLFW_FALSE; };
+
+		glfwDefaultWindowHints();
 		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-#ifdef _WIN32
-		glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
-#endif
-		mHandle = glfwCreateWindow(size[0], size[1], title.c_str(), nullptr, nullptr);
+		glfwWindowHint(GLFW_VISIBLE, Hint(config.visible));
+		glfwWindowHint(GLFW_DECORATED, Hint(config.decorated));
+		glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, Hint(config.transparentFramebuffer));
+		glfwWindowHint(GLFW_SCALE_TO_MONITOR, Hint(config.scaleToMonitor));
+		glfwWindowHint(GLFW_FOCUS_ON_SHOW, Hint(config.focusOnShow));
+		glfwWindowHint(GLFW_RESIZABLE, Hint(config.resizable));
+
+		{
+			ZoneScopedN("glfwCreateWindow");
+			const auto start = std::chrono::steady_clock::now();
+			mHandle = glfwCreateWindow(config.size[0], config.size[1], config.title.c_str(), nullptr, nullptr);
+			mCreationDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		}
+		Core::Assert(mHandle != nullptr);
+
+		mEventQueue.SetCapacity(config.eventQueueCapacity, config.overflowPolicy);
+
 		glfwSetKeyCallback(mHandle, &Window::OnKeyEvent);
 		glfwSetCharCallback(mHandle, &Window::OnTextEvent);
 		glfwSetCursorPosCallback(mHandle, &Window::OnMouseMove);
 		glfwSetMouseButtonCallback(mHandle, &Window::OnMouseButton);
 		glfwSetWindowFocusCallback(mHandle, &Window::OnWindowFocusChange);
 		glfwSetScrollCallback(mHandle, &Window::OnMouseScroll);
+		glfwSetDropCallback(mHandle, &Window::OnDrop);
+		glfwSetWindowCloseCallback(mHandle, &Window::OnWindowClose);
+		glfwSetWindowIconifyCallback(mHandle, &Window::OnWindowIconify);
+		glfwSetWindowSizeCallback(mHandle, &Window::OnWindowSize);
+		glfwSetFramebufferSizeCallback(mHandle, &Window::OnFramebufferSize);
+		glfwSetWindowPosCallback(mHandle, &Window::OnWindowPosition);
+
+		glfwGetWindowSize(mHandle, &mState.size[0], &mState.size[1]);
+		glfwGetFramebufferSize(mHandle, &mState.framebufferSize[0], &mState.framebufferSize[1]);
+		glfwGetWindowPos(mHandle, &mState.position[0], &mState.position[1]);
+		glfwGetCursorPos(mHandle, &mState.cursorPosition[0], &mState.cursorPosition[1]);
+		mState.focused = glfwGetWindowAttrib(mHandle, GLFW_FOCUSED) == GLFW_TRUE;
+		mState.iconified = glfwGetWindowAttrib(mHandle, GLFW_ICONIFIED) == GLFW_TRUE;
+		mPublishedState = std::make_unique<SeqLock<WindowState>>(mState);
 
 		sInstanceMap.Lock()->emplace(mHandle, this);
 	}
@@ -37,8 +80,27 @@ namespace Strawberry::Window
 	Window::Window(Window&& rhs) noexcept
 		: mHandle(std::exchange(rhs.mHandle, nullptr))
 		, mEventQueue(std::move(rhs.mEventQueue))
+		, mState(rhs.mState)
+		, mPublishedState(std::move(rhs.mPublishedState))
+		, mHeldModifierKeys(rhs.mHeldModifierKeys)
+		, mKeyHeld(rhs.mKeyHeld)
+		, mPendingEvents(std::move(rhs.mPendingEvents))
 		, mPreviousMousePosition(std::move(rhs.mPreviousMousePosition))
+		, mCursorPredictor(std::move(rhs.mCursorPredictor))
+		, mRelativeMotion(std::move(rhs.mRelativeMotion))
+		, mSharedEventChannel(std::move(rhs.mSharedEventChannel))
+		, mEventBus(std::move(rhs.mEventBus))
+		, mCommandQueue(std::move(rhs.mCommandQueue))
+		, mExecutor(std::move(rhs.mExecutor))
+		, mEventAwaiters(std::move(rhs.mEventAwaiters))
+		, mCloseAwaiters(std::move(rhs.mCloseAwaiters))
+		, mTitle(std::move(rhs.mTitle))
+		, mCreationDuration(rhs.mCreationDuration)
+		, mWindowedGeometry(std::move(rhs.mWindowedGeometry))
 	{
+		for (EventAwaiter* awaiter : mEventAwaiters) awaiter->mWindow = this;
+		for (CloseAwaiter* awaiter : mCloseAwaiters) awaiter->mWindow = this;
+
 		sInstanceMap.Lock()->insert_or_assign(mHandle, this);
 	}
 
@@ -57,6 +119,10 @@ namespace Strawberry::Window
 
 	Window::~Window()
 	{	ZoneScoped;
+		// Coroutines still waiting on this window are never resumed.
+		for (EventAwaiter* awaiter : mEventAwaiters) awaiter->mWindow = nullptr;
+		for (CloseAwaiter* awaiter : mCloseAwaiters) awaiter->mWindow = nullptr;
+
 		if (mHandle)
 		{
 			glfwDestroyWindow(mHandle);
@@ -69,14 +135,66 @@ namespace Strawberry::Window
 	{
 		ZoneScoped;
 
-		if (mEventQueue.empty())
+		return mEventQueue.Pop();
+	}
+
+
+	Core::Optional<TimedEvent> Window::NextTimedEvent()
+	{
+		ZoneScoped;
+
+		return mEventQueue.PopTimed();
+	}
+
+
+	EventAwaiter Window::NextEventAsync()
+	{
+		return EventAwaiter(*this, nullptr);
+	}
+
+
+	CloseAwaiter Window::CloseRequestedAsync()
+	{
+		return CloseAwaiter(*this);
+	}
+
+
+	void Window::SetExecutor(Executor executor)
+	{
+		mExecutor = std::move(executor);
+	}
+
+
+	void Window::SetBroadcastEnabled(bool enabled)
+	{
+		if (enabled && !mEventBus)
 		{
-			return {};
+			mEventBus = std::make_unique<EventBus>();
 		}
+		else if (!enabled && mEventBus)
+		{
+			Core::Assert(!mEventBus->HasCursors());
+			mEventBus.reset();
+		}
+	}
 
-		auto event(mEventQueue.front());
-		mEventQueue.pop_front();
-		return event;
+
+	EventBus::Cursor Window::CreateEventCursor(EventFilter filter)
+	{
+		Core::Assert(mEventBus != nullptr);
+		return mEventBus->CreateCursor(filter);
+	}
+
+
+	void Window::SetEventQueueCapacity(size_t capacity, OverflowPolicy policy)
+	{
+		mEventQueue.SetCapacity(capacity, policy);
+	}
+
+
+	EventQueueStatistics Window::GetEventQueueStatistics() const
+	{
+		return mEventQueue.GetStatistics();
 	}
 
 
@@ -90,15 +208,115 @@ namespace Strawberry::Window
 
 	Core::Math::Vec2i Window::GetSize() const
 	{
-		Core::Math::Vec2i size;
-		glfwGetWindowSize(mHandle, &size[0], &size[1]);
-		return size;
+		return GetState().size;
+	}
+
+
+	WindowState Window::GetState() const
+	{
+		return mPublishedState->Load();
 	}
 
 
 	bool Window::HasFocus() const noexcept
 	{
-		return mHasFocus;
+		return mState.focused;
+	}
+
+
+	bool Window::IsActive() const
+	{
+		return mState.focused && !mState.iconified && IsVisible();
+	}
+
+
+	bool Window::IsAnyWindowActive()
+	{
+		auto instances = sInstanceMap.Lock();
+		return std::ranges::any_of(*instances | std::views::values, [] (const Window* window) { return window->IsActive(); });
+	}
+
+
+	void Window::Show()
+	{
+		ZoneScoped;
+
+		glfwShowWindow(mHandle);
+	}
+
+
+	void Window::Hide()
+	{
+		ZoneScoped;
+
+		glfwHideWindow(mHandle);
+	}
+
+
+	bool Window::IsVisible() const
+	{
+		return glfwGetWindowAttrib(mHandle, GLFW_VISIBLE) == GLFW_TRUE;
+	}
+
+
+	void Window::EnterFullscreen(const MonitorInfo& monitor, const VideoMode& videoMode)
+	{
+		ZoneScoped;
+
+		Core::Assert(std::ranges::find(monitor.mVideoModes, videoMode) != monitor.mVideoModes.end());
+
+		if (!mWindowedGeometry)
+		{
+			const WindowState state = GetState();
+			mWindowedGeometry = WindowedGeometry{.position = state.position, .size = state.size};
+		}
+
+		glfwSetWindowMonitor(mHandle,
+		                     monitor.mHandle,
+		                     0,
+		                     0,
+		                     static_cast<int>(videoMode.mResolution[0]),
+		                     static_cast<int>(videoMode.mResolution[1]),
+		                     static_cast<int>(videoMode.mRefreshRate));
+		RefreshGeometry();
+	}
+
+
+	void Window::EnterFullscreen(const MonitorInfo& monitor)
+	{
+		EnterFullscreen(monitor, monitor.mCurrentVideoMode);
+	}
+
+
+	void Window::LeaveFullscreen()
+	{
+		ZoneScoped;
+
+		if (!mWindowedGeometry) return;
+
+		const WindowedGeometry geometry = mWindowedGeometry.Unwrap();
+		mWindowedGeometry = Core::NullOpt;
+
+		glfwSetWindowMonitor(mHandle,
+		                     nullptr,
+		                     geometry.position[0],
+		                     geometry.position[1],
+		                     geometry.size[0],
+		                     geometry.size[1],
+		                     GLFW_DONT_CARE);
+		RefreshGeometry();
+	}
+
+
+	bool Window::IsFullscreen() const noexcept
+	{
+		return mWindowedGeometry.HasValue();
+	}
+
+
+	std::chrono::nanoseconds Window::GetCreationDuration() const noexcept
+	{
+		return mCreationDuration;
 	}
 
 
@@ -121,11 +339,22 @@ namespace Strawberry::Window
 
 		auto [size, channels, data] = Core::IO::DynamicByteBuffer::FromImage(iconFile).Unwrap();
 
-		const GLFWimage glfwImage
+		ApplyIcon(WindowCommandQueue::Icon
 		{
 			.width = static_cast<int>(size[0]),
 			.height = static_cast<int>(size[1]),
-			.pixels = data.Data()
+			.pixels = std::move(data)
+		});
+	}
+
+
+	void Window::ApplyIcon(WindowCommandQueue::Icon icon)
+	{
+		const GLFWimage glfwImage
+		{
+			.width = icon.width,
+			.height = icon.height,
+			.pixels = icon.pixels.Data()
 		};
 
 		glfwSetWindowIcon(mHandle, 1, &glfwImage);
@@ -136,6 +365,8 @@ namespace Strawberry::Window
 		ZoneScoped;
 
 		glfwSetInputMode(mHandle, GLFW_CURSOR, enabled ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_DISABLED);
+		// The cursor jumps when its mode changes, which must not be reported as motion.
+		mPreviousMousePosition = Core::NullOpt;
 	}
 
 	void Window::SetRawMouseInputEnabled(bool enabled)
@@ -145,11 +376,117 @@ namespace Strawberry::Window
 		glfwSetInputMode(mHandle, GLFW_RAW_MOUSE_MOTION, enabled ? GLFW_TRUE : GLFW_FALSE);
 	}
 
+	WindowCommandQueue& Window::GetCommandQueue() noexcept
+	{
+		return *mCommandQueue;
+	}
+
+
+	void Window::FlushCommands()
+	{
+		ZoneScoped;
+
+		if (auto title = mCommandQueue->mTitle.Take())
+		{
+			SetTitle(*title);
+		}
+
+		if (auto icon = mCommandQueue->mIcon.Take())
+		{
+			ApplyIcon(std::move(*icon));
+		}
+
+		if (auto enabled = mCommandQueue->mCursorEnabled.Take())
+		{
+			SetCursorEnabled(*enabled);
+		}
+
+		if (auto enabled = mCommandQueue->mRawMouseInputEnabled.Take())
+		{
+			SetRawMouseInputEnabled(*enabled);
+		}
+	}
+
+
+	void Window::SubmitEvent(Event event)
+	{
+		Enqueue(std::move(event), glfwGetTime());
+	}
+
+
+	void Window::SetCursorPredictionEnabled(bool enabled)
+	{
+		if (enabled && !mCursorPredictor)
+		{
+			mCursorPredictor = Input::CursorPredictor();
+		}
+		else if (!enabled)
+		{
+			mCursorPredictor = Core::NullOpt;
+		}
+	}
+
+
+	Core::Optional<Core::Math::Vec2f> Window::PredictCursorPosition(double presentTime) const
+	{
+		if (!mCursorPredictor) return Core::NullOpt;
+
+		return mCursorPredictor->Predict(presentTime).Map([] (const auto& position) { return position.template AsType<float>(); });
+	}
+
+
+	void Window::SetRelativeMotionEnabled(bool enabled)
+	{
+		if (enabled && !mRelativeMotion)
+		{
+			mRelativeMotion = Input::RelativeMotionAccumulator();
+		}
+		else if (!enabled)
+		{
+			mRelativeMotion = Core::NullOpt;
+		}
+	}
+
+
+	Core::Math::Vec2 Window::TakeRelativeMotion()
+	{
+		return mRelativeMotion ? mRelativeMotion->TakeDelta() : Core::Math::Vec2();
+	}
+
+
+	Core::Math::Vec2 Window::TakeRelativeMotionUntil(double time)
+	{
+		return mRelativeMotion ? mRelativeMotion->TakeDeltaUntil(time) : Core::Math::Vec2();
+	}
+
+
+	double Window::GetTime()
+	{
+		return glfwGetTime();
+	}
+
+
+	bool Window::OpenSharedEventChannel(const std::string& name, uint32_t capacity)
+	{
+		ZoneScoped;
+
+		mSharedEventChannel = SharedEventChannel::Create(name, capacity);
+		return mSharedEventChannel.HasValue();
+	}
+
+
+	void Window::CloseSharedEventChannel()
+	{
+		mSharedEventChannel = Core::NullOpt;
+	}
+
+
 	void Window::OnKeyEvent(GLFWwindow* windowHandle, int key, int scancode, int action, int mods)
 	{
 		ZoneScoped;
 
 		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		const double time = glfwGetTime();
 
 		auto GetAction = [](int action)
 		{
@@ -177,6 +514,38 @@ namespace Strawberry::Window
 		};
 
 
+		auto GetModifierKeyBit = [](int key) -> uint8_t
+		{
+			switch (key)
+			{
+				case GLFW_KEY_LEFT_CONTROL:  return 1 << 0;
+				case GLFW_KEY_RIGHT_CONTROL: return 1 << 1;
+				case GLFW_KEY_LEFT_SHIFT:    return 1 << 2;
+				case GLFW_KEY_RIGHT_SHIFT:   return 1 << 3;
+				case GLFW_KEY_LEFT_ALT:      return 1 << 4;
+				case GLFW_KEY_RIGHT_ALT:     return 1 << 5;
+				case GLFW_KEY_LEFT_SUPER:    return 1 << 6;
+				case GLFW_KEY_RIGHT_SUPER:   return 1 << 7;
+				default:                     return 0;
+			}
+		};
+
+
+		if (const uint8_t bit = GetModifierKeyBit(key))
+		{
+			if (action == GLFW_RELEASE) window->mHeldModifierKeys &= ~bit;
+			else                        window->mHeldModifierKeys |= bit;
+
+			Input::Modifiers modifiers = 0;
+			if (window->mHeldModifierKeys & 0b00000011) modifiers = modifiers | Input::Modifier::CTRL;
+			if (window->mHeldModifierKeys & 0b00001100) modifiers = modifiers | Input::Modifier::SHIFT;
+			if (window->mHeldModifierKeys & 0b00110000) modifiers = modifiers | Input::Modifier::ALT;
+			if (window->mHeldModifierKeys & 0b11000000) modifiers = modifiers | Input::Modifier::META;
+			window->mState.modifiers = modifiers;
+			window->PublishState();
+		}
+
+
 		Events::Key event
 		{
 			.keyCode = Input::IntoKeyCode(key).UnwrapOr(Input::KeyCode::Unknown),
@@ -185,7 +554,7 @@ namespace Strawberry::Window
 			.action = GetAction(action),
 		};
 
-		window->mEventQueue.emplace_back(event);
+		window->Enqueue(event, time);
 	}
 
 
@@ -194,10 +563,11 @@ namespace Strawberry::Window
 		ZoneScoped;
 
 		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		const double time = glfwGetTime();
 
 		Events::Text event {.codepoint = static_cast<char32_t>(codepoint)};
 
-		window->mEventQueue.emplace_back(event);
+		window->Enqueue(event, time);
 	}
 
 
@@ -207,21 +577,32 @@ namespace Strawberry::Window
 
 		Window* window = sInstanceMap.Lock()->at(windowHandle);
 
-		Core::Math::Vec2f newPos(x, y);
+		const double           time = glfwGetTime();
+		const Core::Math::Vec2 newPosition(x, y);
+		const Core::Math::Vec2 delta = window->mPreviousMousePosition
+			.Map([&] (const auto& previous) { return newPosition - previous; })
+			.UnwrapOr(Core::Math::Vec2());
 
 		Events::MouseMove event{
-			.position = Core::Math::Vec2f(x, y),
-			.deltaPosition = window->mPreviousMousePosition
-			                       .Map([=](const auto& prev) -> Core::Math::Vec2f
-			                       {
-				                       return newPos - prev;
-			                       })
-			                       .UnwrapOr(Core::Math::Vec2f()),
+			.position = newPosition.AsType<float>(),
+			.deltaPosition = delta.AsType<float>(),
 		};
 
-		window->mPreviousMousePosition = event.position;
+		window->mPreviousMousePosition = newPosition;
+		window->mState.cursorPosition  = newPosition;
+		window->PublishState();
+
+		if (window->mRelativeMotion)
+		{
+			window->mRelativeMotion->AddSample(delta, time);
+		}
+
+		if (window->mCursorPredictor)
+		{
+			window->mCursorPredictor->AddSample(newPosition, time);
+		}
 
-		window->mEventQueue.emplace_back(event);
+		window->Enqueue(event, time);
 	}
 
 
@@ -230,6 +611,7 @@ namespace Strawberry::Window
 		ZoneScoped;
 
 		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		const double time = glfwGetTime();
 
 		auto GetButton = [](int code)
 		{
@@ -272,18 +654,14 @@ namespace Strawberry::Window
 		};
 
 
-		Core::Math::Vec2 position;
-		glfwGetCursorPos(windowHandle, &position[0], &position[1]);
-
-
 		Events::MouseButton event{
 			.button = GetButton(button),
 			.modifiers = GetModifier(mods),
 			.action = GetAction(action),
-			.position = position.AsType<float>()
+			.position = window->mState.cursorPosition.AsType<float>()
 		};
 
-		window->mEventQueue.emplace_back(event);
+		window->Enqueue(event, time);
 	}
 
 
@@ -292,13 +670,14 @@ namespace Strawberry::Window
 		ZoneScoped;
 
 		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		const double time = glfwGetTime();
 
 		Events::MouseScroll event
 		{
 			.scroll = {xOffset, yOffset},
 		};
 
-		window->mEventQueue.emplace_back(event);
+		window->Enqueue(event, time);
 	}
 
 
@@ -306,57 +685,265 @@ namespace Strawberry::Window
 	{
 		ZoneScoped;
 
-		Window* window    = sInstanceMap.Lock()->at(windowHandle);
-		window->mHasFocus = focus == GLFW_TRUE;
-		window->mEventQueue.emplace_back(Events::Focus{.focussed = window->HasFocus()});
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		const double time = glfwGetTime();
+		window->mState.focused = focus == GLFW_TRUE;
+		window->PublishState();
+		window->Enqueue(Events::Focus{.focussed = window->HasFocus()}, time);
 	}
 
 
-	Input::Modifiers Window::GetCurrentModifierFlags() const
+	void Window::OnWindowClose(GLFWwindow* windowHandle)
+	{
+		ZoneScoped;
+
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+
+		for (CloseAwaiter* awaiter : std::exchange(window->mCloseAwaiters, {}))
+		{
+			awaiter->mWindow = nullptr;
+			window->MakeReady(awaiter->mHandle);
+		}
+	}
+
+
+	void Window::OnDrop(GLFWwindow* windowHandle, int pathCount, const char* paths[])
+	{
+		ZoneScoped;
+
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		const double time = glfwGetTime();
+		window->Enqueue(Events::Drop(std::span<const char* const>(paths, pathCount)), time);
+	}
+
+
+	void Window::OnWindowIconify(GLFWwindow* windowHandle, int iconified)
 	{
 		ZoneScoped;
 
-		Input::Modifiers modifiers = 0;
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		window->mState.iconified = iconified == GLFW_TRUE;
+		window->PublishState();
+	}
+
+
+	void Window::OnWindowSize(GLFWwindow* windowHandle, int width, int height)
+	{
+		ZoneScoped;
+
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		window->mState.size = Core::Math::Vec2i(width, height);
+		window->PublishState();
+	}
+
+
+	void Window::OnFramebufferSize(GLFWwindow* windowHandle, int width, int height)
+	{
+		ZoneScoped;
+
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		window->mState.framebufferSize = Core::Math::Vec2i(width, height);
+		window->PublishState();
+	}
+
 
-		if (glfwGetKey(mHandle, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS
-			|| glfwGetKey(mHandle, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+	void Window::OnWindowPosition(GLFWwindow* windowHandle, int x, int y)
+	{
+		ZoneScoped;
+
+		Window* window = sInstanceMap.Lock()->at(windowHandle);
+		window->mState.position = Core::Math::Vec2i(x, y);
+		window->PublishState();
+	}
+
+
+	Input::Modifiers Window::GetCurrentModifierFlags() const
+	{
+		return mState.modifiers;
+	}
+
+
+	void Window::PublishState()
+	{
+		mPublishedState->Store(mState);
+	}
+
+
+	void Window::RefreshGeometry()
+	{
+		glfwGetWindowSize(mHandle, &mState.size[0], &mState.size[1]);
+		glfwGetFramebufferSize(mHandle, &mState.framebufferSize[0], &mState.framebufferSize[1]);
+		glfwGetWindowPos(mHandle, &mState.position[0], &mState.position[1]);
+		PublishState();
+	}
+
+
+	void Window::Enqueue(Event event, double timestamp)
+	{
+		mPendingEvents.emplace_back(PendingEvent{.event = std::move(event), .timestamp = timestamp, .injected = {}});
+	}
+
+
+	void Window::Dispatch(PendingEvent& pending)
+	{
+		if (mSharedEventChannel)
 		{
-			modifiers = modifiers | Input::Modifier::CTRL;
+			if (pending.injected)
+			{
+				mSharedEventChannel->Publish(*pending.injected);
+			}
+			else if (auto record = IntoEventRecord(pending.event, pending.timestamp))
+			{
+				mSharedEventChannel->Publish(*record);
+			}
 		}
 
-		if (glfwGetKey(mHandle, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS
-			|| glfwGetKey(mHandle, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+		Deliver(std::move(pending.event), pending.timestamp);
+	}
+
+
+	void Window::Deliver(Event event, double timestamp)
+	{
+		if (mEventBus)
 		{
-			modifiers = modifiers | Input::Modifier::SHIFT;
+			mEventBus->Append(event);
 		}
 
-		if (glfwGetKey(mHandle, GLFW_KEY_LEFT_ALT) == GLFW_PRESS
-			|| glfwGetKey(mHandle, GLFW_KEY_RIGHT_ALT) == GLFW_PRESS)
+		auto awaiter = std::ranges::find_if(mEventAwaiters, [&event] (const EventAwaiter* awaiter)
+		{
+			return !awaiter->mFilter || awaiter->mFilter(event);
+		});
+
+		if (awaiter != mEventAwaiters.end())
 		{
-			modifiers = modifiers | Input::Modifier::ALT;
+			EventAwaiter* waiting = *awaiter;
+			mEventAwaiters.erase(awaiter);
+			waiting->mWindow = nullptr;
+			waiting->mEvent  = std::move(event);
+			MakeReady(waiting->mHandle);
+			return;
 		}
 
-		if (glfwGetKey(mHandle, GLFW_KEY_LEFT_SUPER) == GLFW_PRESS
-			|| glfwGetKey(mHandle, GLFW_KEY_LEFT_SUPER) == GLFW_PRESS)
+		if (!mEventBus)
 		{
-			modifiers = modifiers | Input::Modifier::META;
+			mEventQueue.Push(std::move(event), timestamp);
 		}
+	}
+
 
-		return modifiers;
+	void Window::MakeReady(std::coroutine_handle<> handle)
+	{
+		sReadyCoroutines.emplace_back(ReadyCoroutine{.handle = handle, .executor = mExecutor});
 	}
 
 
-	void PollInput()
+	void Window::CancelReady(std::coroutine_handle<> handle)
+	{
+		std::erase_if(sReadyCoroutines, [handle] (const ReadyCoroutine& ready) { return ready.handle == handle; });
+	}
+
+
+	void Window::ResumeReady()
 	{
 		ZoneScoped;
 
-		glfwPollEvents();
+		// Resumed coroutines may destroy coroutines which are still waiting in the list, so it is consumed one entry
+		// at a time.
+		while (!sReadyCoroutines.empty())
+		{
+			ReadyCoroutine ready = std::move(sReadyCoroutines.front());
+			sReadyCoroutines.pop_front();
+
+			if (ready.executor)
+			{
+				ready.executor(ready.handle);
+			}
+			else
+			{
+				ready.handle.resume();
+			}
+		}
+	}
+
+
+	std::vector<Window*> Window::CollectInput(Core::Optional<std::chrono::duration<double>> waitTimeout)
+	{
+		ZoneScoped;
+
+		// Work on a snapshot of the instance map, so that the map is not locked while events are delivered. Windows
+		// cannot be created or destroyed until ResumeReady(), so the snapshot stays valid.
+		const std::vector<Window*> windows = *Window::sInstanceMap.Lock()
+			| std::views::values
+			| std::ranges::to<std::vector>();
+
+
+		for (Window* window : windows)
+		{
+			window->FlushCommands();
+
+			// Start a new broadcast segment, so that events from this poll can be released as a unit.
+			if (window->mEventBus)
+			{
+				window->mEventBus->EndFrame();
+			}
+		}
+
+
+		// GLFW dispatches events for every window at once, so a single full queue under OverflowPolicy::Block leaves
+		// all events with the window system until it is drained.
+		bool blocked = false;
+		for (Window* window : windows)
+		{
+			blocked = window->mEventQueue.BlockIfFull() || blocked;
+		}
+
+		if (blocked) return {};
+
+
+		if (waitTimeout && ShouldWaitForInput(windows))
+		{
+			if (*waitTimeout == std::chrono::duration<double>::max())
+			{
+				glfwWaitEvents();
+			}
+			else
+			{
+				glfwWaitEventsTimeout(waitTimeout->count());
+			}
+		}
+		else
+		{
+			PowerGovernor::WaitForInput();
+		}
+
+
+		// Injected records are stamped on another process's clock, and hold events have no input time, so both are
+		// stamped with the time of this poll.
+		const double pollTime = glfwGetTime();
+
+
+		// Merge events injected through shared event channels.
+		for (Window* window : windows)
+		{
+			if (!window->mSharedEventChannel) continue;
+
+			auto& channel = *window->mSharedEventChannel;
+			channel.DrainInjected([&] (const EventRecord& record)
+			{
+				if (auto event = IntoEvent(record))
+				{
+					window->mPendingEvents.emplace_back(PendingEvent{.event = event.Unwrap(), .timestamp = pollTime, .injected = record});
+				}
+			});
+		}
 
 
 		// Insert a hold event for every key that is currently held down.
-		for (auto&& window : *Window::sInstanceMap.Lock())
+		for (Window* window : windows)
 		{
-			const Input::Modifiers modifiers = window.second->GetCurrentModifierFlags();
+			window->mKeyHeld = false;
+
+			const Input::Modifiers modifiers = window->GetCurrentModifierFlags();
 			for (int i = 0; i < GLFW_KEY_LAST; i++)
 			{
 				auto keycode = Input::IntoKeyCode(i);
@@ -365,7 +952,7 @@ namespace Strawberry::Window
 				auto scanCode = glfwGetKeyScancode(i);
 				if (scanCode == -1) continue;
 
-				if (glfwGetKey(window.second->mHandle, i) == GLFW_PRESS)
+				if (glfwGetKey(window->mHandle, i) == GLFW_PRESS)
 				{
 					Events::Key holdEvent
 					{
@@ -375,9 +962,50 @@ namespace Strawberry::Window
 						.action = Input::KeyAction::Hold
 					};
 
-					window.second->mEventQueue.emplace_back(holdEvent);
+					window->Enqueue(holdEvent, pollTime);
+					window->mKeyHeld = true;
 				}
 			}
 		}
+
+		return windows;
+	}
+
+
+	bool Window::ShouldWaitForInput(const std::vector<Window*>& windows)
+	{
+		bool awaited = false;
+
+		for (const Window* window : windows)
+		{
+			// Staged events and hold events are dispatched by this poll, and may resume a coroutine without waiting.
+			if (!window->mPendingEvents.empty()) return false;
+			if (window->mKeyHeld && !window->mEventAwaiters.empty()) return false;
+
+			awaited = awaited || !window->mEventAwaiters.empty() || !window->mCloseAwaiters.empty();
+		}
+
+		return awaited;
+	}
+
+
+	void PollInput()
+	{
+		Input::Pipeline<> passthrough;
+		PollInput(passthrough);
+	}
+
+
+	void WaitInput()
+	{
+		Input::Pipeline<> passthrough;
+		WaitInput(passthrough);
+	}
+
+
+	void WaitInput(std::chrono::duration<double> timeout)
+	{
+		Input::Pipeline<> passthrough;
+		WaitInput(passthrough, timeout);
 	}
 }
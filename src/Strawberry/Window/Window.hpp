@@ -6,7 +6,18 @@
 //----------------------------------------------------------------------------------------------------------------------
 #include "GLFW.hpp"
 // Strawberry Graphics
+#include "Strawberry/Window/Awaiters.hpp"
 #include "Strawberry/Window/Event.hpp"
+#include "Strawberry/Window/EventBus.hpp"
+#include "Strawberry/Window/EventQueue.hpp"
+#include "Strawberry/Window/Monitor.hpp"
+#include "Strawberry/Window/SeqLock.hpp"
+#include "Strawberry/Window/SharedEventChannel.hpp"
+#include "Strawberry/Window/WindowCommandQueue.hpp"
+#include "Strawberry/Window/WindowConfig.hpp"
+#include "Strawberry/Window/Input/CursorPredictor.hpp"
+#include "Strawberry/Window/Input/Pipeline.hpp"
+#include "Strawberry/Window/Input/RelativeMotion.hpp"
 // Strawberry Core
 #include "Strawberry/Core/Math/Vector.hpp"
 #include "Strawberry/Core/Types/Optional.hpp"
@@ -15,11 +26,15 @@
 #include "GLFW/glfw3.h"
 // Standard Library
 #include <atomic>
+#include <chrono>
 #include <concepts>
 #include <deque>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 #include <filesystem>
+#include <functional>
 
 
 //======================================================================================================================
@@ -36,34 +51,98 @@ namespace Strawberry::Vulkan
 //----------------------------------------------------------------------------------------------------------------------
 namespace Strawberry::Window
 {
+	// Snapshot of window properties, maintained from GLFW callbacks.
+	struct WindowState
+	{
+		Core::Math::Vec2i size;
+		Core::Math::Vec2i framebufferSize;
+		Core::Math::Vec2i position;
+		Core::Math::Vec2  cursorPosition;
+		Input::Modifiers  modifiers = 0;
+		bool              focused   = true;
+		bool              iconified = false;
+	};
+
+
 	class Window
 		: public GLFWUser
 	{
 		friend class Vulkan::Surface;
-		friend void PollInput();
+		friend class EventAwaiter;
+		friend class CloseAwaiter;
+		template<Input::PipelineStage... Stages>
+		friend void PollInput(Input::Pipeline<Stages...>& pipeline);
+		template<Input::PipelineStage... Stages>
+		friend void WaitInput(Input::Pipeline<Stages...>& pipeline, std::chrono::duration<double> timeout);
 
 
 		static Core::Mutex<std::map<GLFWwindow*, Window*>> sInstanceMap;
 
 
+		// Coroutines made ready while events were dispatched, resumed once PollInput() has finished polling.
+		struct ReadyCoroutine
+		{
+			std::coroutine_handle<> handle;
+			Executor                executor;
+		};
+
+
+		static std::deque<ReadyCoroutine> sReadyCoroutines;
+
+
 	public:
 		//======================================================================================================================
 		//  Construction, Destruction and Assignment
 		//----------------------------------------------------------------------------------------------------------------------
 		Window(const std::string& title, Core::Math::Vec2i size);
+		explicit Window(const WindowConfig& config);
 		Window(const Window& rhs)            = delete;
 		Window& operator=(const Window& rhs) = delete;
 		Window(Window&& rhs) noexcept;
 		Window& operator=(Window&& rhs) noexcept;
 		~Window();
 
-		Core::Optional<Event> NextEvent();
+		Core::Optional<Event>      NextEvent();
+		Core::Optional<TimedEvent> NextTimedEvent();
+
+
+		// Bounds the number of queued events. A capacity of 0 leaves the queue unbounded.
+		void                 SetEventQueueCapacity(size_t capacity, OverflowPolicy policy = OverflowPolicy::DropOldest);
+		EventQueueStatistics GetEventQueueStatistics() const;
 
 		bool CloseRequested() const;
 
+
+		// Awaitable alternatives to NextEvent() and CloseRequested().
+		// Waiting coroutines are resumed through the executor at the end of PollInput(), never from inside a GLFW
+		// callback, so they may freely create, move or destroy windows. WaitInput() drives them without spinning.
+		[[nodiscard]] EventAwaiter NextEventAsync();
+		[[nodiscard]] CloseAwaiter CloseRequestedAsync();
+
+
+		template<typename T>
+		[[nodiscard]] EventAwaiter NextEventAsync()
+		{
+			return EventAwaiter(*this, [] (const Event& event) { return event.IsType<T>(); });
+		}
+
+
+		// Sets how waiting coroutines are resumed. By default PollInput() resumes them directly.
+		void SetExecutor(Executor executor);
+
+
+		// In broadcast mode events are appended to an EventBus instead of the queue, and read through cursors.
+		// Broadcast mode may only be disabled once every cursor has been destroyed.
+		void             SetBroadcastEnabled(bool enabled);
+		EventBus::Cursor CreateEventCursor(EventFilter filter = nullptr);
+
 		[[nodiscard]] Core::Math::Vec2i GetSize() const;
 
 
+		// Returns the latest published state. Safe to call from any thread.
+		[[nodiscard]] WindowState GetState() const;
+
+
 		template<std::movable T, typename... Args> requires (std::constructible_from<T, const Window&, Args...>)
 		T Create(const Args&... args)
 		{
@@ -74,6 +153,29 @@ namespace Strawberry::Window
 		bool HasFocus() const noexcept;
 
 
+		// A window is active when it is visible, not iconified and focused.
+		bool        IsActive() const;
+		static bool IsAnyWindowActive();
+
+
+		void Show();
+		void Hide();
+		bool IsVisible() const;
+
+
+		// Exclusive fullscreen on a monitor, in one of its video modes.
+		// Leaving fullscreen restores the position and size the window had before entering it. The new geometry is
+		// published by the time these return.
+		void EnterFullscreen(const MonitorInfo& monitor, const VideoMode& videoMode);
+		void EnterFullscreen(const MonitorInfo& monitor);
+		void LeaveFullscreen();
+		bool IsFullscreen() const noexcept;
+
+
+		// Time spent inside glfwCreateWindow when this window was created.
+		std::chrono::nanoseconds GetCreationDuration() const noexcept;
+
+
 		const std::string& GetTitle() const;
 		void               SetTitle(const std::string& title);
 
@@ -83,6 +185,37 @@ namespace Strawberry::Window
 		void SetCursorEnabled(bool enabled);
 		void SetRawMouseInputEnabled(bool enabled);
 
+
+		// Queue for changing the title, icon and cursor modes from other threads. Posted commands are applied by the
+		// next PollInput(). The queue keeps its address when the window is moved.
+		WindowCommandQueue& GetCommandQueue() noexcept;
+
+
+		// Queues a synthetic event as if the window system had reported it. It passes through the input pipeline in the
+		// next PollInput().
+		void SubmitEvent(Event event);
+
+
+		// Cursor prediction extrapolates the cursor to a presentation time on the GLFW timer (see GetTime()).
+		void SetCursorPredictionEnabled(bool enabled);
+		Core::Optional<Core::Math::Vec2f> PredictCursorPosition(double presentTime) const;
+
+
+		// Relative motion is accumulated in double precision from cursor callbacks, for use with a disabled cursor.
+		// Motion can be taken per frame, or up to a time on the GLFW timer for fixed simulation ticks.
+		void             SetRelativeMotionEnabled(bool enabled);
+		Core::Math::Vec2 TakeRelativeMotion();
+		Core::Math::Vec2 TakeRelativeMotionUntil(double time);
+
+
+		static double GetTime();
+
+
+		// Publishes this window's events to a named shared memory channel, and merges events injected into it.
+		// Returns false if the channel could not be created, or its name is already in use.
+		bool OpenSharedEventChannel(const std::string& name, uint32_t capacity = 4096);
+		void CloseSharedEventChannel();
+
 	private:
 		static void OnKeyEvent(GLFWwindow* windowHandle, int key, int scancode, int action, int mods);
 		static void OnTextEvent(GLFWwindow* windowHandle, unsigned int codepoint);
@@ -90,21 +223,155 @@ namespace Strawberry::Window
 		static void OnMouseButton(GLFWwindow* windowHandle, int button, int action, int mods);
 		static void OnMouseScroll(GLFWwindow* windowHandle, double xOffset, double yOffset);
 		static void OnWindowFocusChange(GLFWwindow* windowHandle, int focus);
+		static void OnWindowClose(GLFWwindow* windowHandle);
+		static void OnDrop(GLFWwindow* windowHandle, int pathCount, const char* paths[]);
+		static void OnWindowIconify(GLFWwindow* windowHandle, int iconified);
+		static void OnWindowSize(GLFWwindow* windowHandle, int width, int height);
+		static void OnFramebufferSize(GLFWwindow* windowHandle, int width, int height);
+		static void OnWindowPosition(GLFWwindow* windowHandle, int x, int y);
 
 
 		Input::Modifiers GetCurrentModifierFlags() const;
 
 
+		void PublishState();
+		// Reads the size, framebuffer size and position back from GLFW, which does not always report them through
+		// callbacks, and publishes them.
+		void RefreshGeometry();
+
+
+		// Event reported during a poll, held until the input pipeline has run over it.
+		struct PendingEvent
+		{
+			Event                       event;
+			double                      timestamp;
+			// Set for events injected through the shared event channel, which bypass the input pipeline.
+			Core::Optional<EventRecord> injected;
+		};
+
+
+		// Polls the window system and stages its events in each window's mPendingEvents. Given a timeout, waits up to
+		// that long for events instead, if a coroutine is waiting on a window and nothing staged could resume it.
+		// Returns the windows to dispatch, which is none while polling is blocked.
+		static std::vector<Window*> CollectInput(Core::Optional<std::chrono::duration<double>> waitTimeout);
+		static bool                 ShouldWaitForInput(const std::vector<Window*>& windows);
+		// Runs pipeline over the events staged by CollectInput(), dispatches them and resumes ready coroutines.
+		template<Input::PipelineStage... Stages>
+		static void DispatchInput(const std::vector<Window*>& windows, Input::Pipeline<Stages...>& pipeline);
+
+
+		// Stages an event from the window system for the input pipeline.
+		// The timestamp is read once per callback, so the published and queued copies agree.
+		void Enqueue(Event event, double timestamp);
+		// Publishes a staged event which passed the input pipeline, and delivers it.
+		void Dispatch(PendingEvent& pending);
+		// Hands an event to a waiting coroutine, or queues it.
+		void Deliver(Event event, double timestamp);
+		// Schedules a waiting coroutine to be resumed through this window's executor.
+		void MakeReady(std::coroutine_handle<> handle);
+		// Forgets a coroutine that was made ready but is being destroyed before being resumed.
+		static void CancelReady(std::coroutine_handle<> handle);
+		static void ResumeReady();
+
+		// Applies the commands posted to the command queue since the last poll.
+		void FlushCommands();
+		void ApplyIcon(WindowCommandQueue::Icon icon);
+
+
 	private:
-		GLFWwindow*       mHandle = nullptr;
-		bool              mHasFocus = true;
-		std::deque<Event> mEventQueue;
+		GLFWwindow* mHandle = nullptr;
+		EventQueue  mEventQueue;
+
+		// Main thread copy of the window state, and the copy published to other threads.
+		WindowState                           mState;
+		std::unique_ptr<SeqLock<WindowState>> mPublishedState;
+		// One bit per held modifier key, used to derive mState.modifiers.
+		uint8_t                               mHeldModifierKeys = 0;
+		// Whether the last poll found a key held down, in which case the next poll generates hold events.
+		bool                                  mKeyHeld = false;
+
+		std::vector<PendingEvent> mPendingEvents;
+
+		Core::Optional<Core::Math::Vec2> mPreviousMousePosition;
+
+		Core::Optional<Input::CursorPredictor>           mCursorPredictor;
+		Core::Optional<Input::RelativeMotionAccumulator> mRelativeMotion;
 
-		Core::Optional<Core::Math::Vec2f> mPreviousMousePosition;
+		Core::Optional<SharedEventChannel> mSharedEventChannel;
+
+		std::unique_ptr<EventBus> mEventBus;
+
+		std::unique_ptr<WindowCommandQueue> mCommandQueue;
+
+		Executor                   mExecutor;
+		std::vector<EventAwaiter*> mEventAwaiters;
+		std::vector<CloseAwaiter*> mCloseAwaiters;
 
 		std::string mTitle;
+
+		std::chrono::nanoseconds mCreationDuration{0};
+
+		struct WindowedGeometry
+		{
+			Core::Math::Vec2i position;
+			Core::Math::Vec2i size;
+		};
+
+
+		Core::Optional<WindowedGeometry> mWindowedGeometry;
 	};
 
 
+	template<Input::PipelineStage... Stages>
+	void Window::DispatchInput(const std::vector<Window*>& windows, Input::Pipeline<Stages...>& pipeline)
+	{
+		ZoneScoped;
+
+		for (Window* window : windows)
+		{
+			for (PendingEvent& pending : window->mPendingEvents)
+			{
+				if (pending.injected || pipeline(pending.event))
+				{
+					window->Dispatch(pending);
+				}
+			}
+
+			window->mPendingEvents.clear();
+		}
+
+		ResumeReady();
+	}
+
+
+	// Polls the window system, and runs every event through pipeline before it is queued or delivered.
+	// The pipeline's type is known here, so its stages are inlined into the dispatch loop.
+	template<Input::PipelineStage... Stages>
+	void PollInput(Input::Pipeline<Stages...>& pipeline)
+	{
+		Window::DispatchInput(Window::CollectInput(Core::NullOpt), pipeline);
+	}
+
+
+	// Like PollInput(), but while a coroutine is waiting on a window, blocks until the window system reports an event
+	// or the timeout elapses, so a loop driving coroutines does not spin. With nothing waiting, polls as usual.
+	// Commands and injected events do not end the wait.
+	template<Input::PipelineStage... Stages>
+	void WaitInput(Input::Pipeline<Stages...>& pipeline, std::chrono::duration<double> timeout)
+	{
+		Window::DispatchInput(Window::CollectInput(timeout), pipeline);
+	}
+
+
+	template<Input::PipelineStage... Stages>
+	void WaitInput(Input::Pipeline<Stages...>& pipeline)
+	{
+		WaitInput(pipeline, std::chrono::duration<double>::max());
+	}
+
+
+	// Polls, or waits for, the window system without an input pipeline.
 	void PollInput();
+	void WaitInput();
+	void WaitInput(std::chrono::duration<double> timeout);
 }
@@ -0,0 +1,38 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "WindowCommandQueue.hpp"
+
+
+namespace Strawberry::Window
+{
+	void WindowCommandQueue::PostTitle(std::string title)
+	{
+		mTitle.Post(std::move(title));
+	}
+
+
+	void WindowCommandQueue::PostIcon(const std::filesystem::path& iconFile)
+	{
+		auto [size, channels, data] = Core::IO::DynamicByteBuffer::FromImage(iconFile).Unwrap();
+
+		mIcon.Post(Icon
+		{
+			.width = static_cast<int>(size[0]),
+			.height = static_cast<int>(size[1]),
+			.pixels = std::move(data)
+		});
+	}
+
+
+	void WindowCommandQueue::PostCursorEnabled(bool enabled)
+	{
+		mCursorEnabled.Post(enabled);
+	}
+
+
+	void WindowCommandQueue::PostRawMouseInputEnabled(bool enabled)
+	{
+		mRawMouseInputEnabled.Post(enabled);
+	}
+}
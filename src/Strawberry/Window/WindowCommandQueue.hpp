@@ -0,0 +1,83 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Core
+#include "Strawberry/Core/IO/DynamicByteBuffer.hpp"
+// Standard Library
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	class Window;
+
+
+	// Holds the most recent value posted for a property.
+	// Posting replaces any value not yet taken with a single atomic exchange, so posters never wait on each other or
+	// on the taker.
+	template<typename T>
+	class CommandSlot
+	{
+	public:
+		CommandSlot() = default;
+		CommandSlot(const CommandSlot&)            = delete;
+		CommandSlot& operator=(const CommandSlot&) = delete;
+
+
+		~CommandSlot()
+		{
+			delete mValue.load(std::memory_order_acquire);
+		}
+
+
+		void Post(T value)
+		{
+			delete mValue.exchange(new T(std::move(value)), std::memory_order_acq_rel);
+		}
+
+
+		std::unique_ptr<T> Take() noexcept
+		{
+			return std::unique_ptr<T>(mValue.exchange(nullptr, std::memory_order_acq_rel));
+		}
+
+	private:
+		std::atomic<T*> mValue = nullptr;
+	};
+
+
+	// Window property changes posted from any thread, applied by PollInput() on the main thread.
+	// Commands coalesce per property, so only the last value posted before each poll is applied.
+	class WindowCommandQueue
+	{
+		friend class Window;
+
+	public:
+		struct Icon
+		{
+			int                         width;
+			int                         height;
+			Core::IO::DynamicByteBuffer pixels;
+		};
+
+
+		void PostTitle(std::string title);
+		// The image is decoded on the posting thread.
+		void PostIcon(const std::filesystem::path& iconFile);
+		void PostCursorEnabled(bool enabled);
+		void PostRawMouseInputEnabled(bool enabled);
+
+	private:
+		CommandSlot<std::string> mTitle;
+		CommandSlot<Icon>        mIcon;
+		CommandSlot<bool>        mCursorEnabled;
+		CommandSlot<bool>        mRawMouseInputEnabled;
+	};
+}
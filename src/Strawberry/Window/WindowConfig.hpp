@@ -0,0 +1,65 @@
+#pragma once
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+// Strawberry Window
+#include "Strawberry/Window/EventQueue.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Math/Vector.hpp"
+// Standard Library
+#include <string>
+
+
+//======================================================================================================================
+//  Class Declaration
+//----------------------------------------------------------------------------------------------------------------------
+namespace Strawberry::Window
+{
+	// Creation parameters for a Window. Every hint is applied explicitly, starting from GLFW's defaults.
+	//
+	// Creating a window with visible set to false and calling Window::Show() once it is set up avoids the compositor
+	// presenting, resizing or focusing a window that is still being initialised.
+	struct WindowConfig
+	{
+		WindowConfig(std::string title, Core::Math::Vec2i size)
+			: title(std::move(title))
+			, size(size)
+		{}
+
+
+		WindowConfig& SetTitle(std::string value)               { title = std::move(value); return *this; }
+		WindowConfig& SetSize(Core::Math::Vec2i value)          { size = value; return *this; }
+		WindowConfig& SetVisible(bool value)                    { visible = value; return *this; }
+		WindowConfig& SetDecorated(bool value)                  { decorated = value; return *this; }
+		WindowConfig& SetTransparentFramebuffer(bool value)     { transparentFramebuffer = value; return *this; }
+		WindowConfig& SetScaleToMonitor(bool value)             { scaleToMonitor = value; return *this; }
+		WindowConfig& SetFocusOnShow(bool value)                { focusOnShow = value; return *this; }
+		WindowConfig& SetResizable(bool value)                  { resizable = value; return *this; }
+
+
+		WindowConfig& SetEventQueueCapacity(size_t capacity, OverflowPolicy policy = OverflowPolicy::DropOldest)
+		{
+			eventQueueCapacity = capacity;
+			overflowPolicy     = policy;
+			return *this;
+		}
+
+
+		std::string       title;
+		Core::Math::Vec2i size;
+
+		bool visible                = true;
+		bool decorated              = true;
+		bool transparentFramebuffer = false;
+		bool scaleToMonitor         = false;
+		bool focusOnShow            = true;
+#ifdef _WIN32
+		bool resizable              = false;
+#else
+		bool resizable              = true;
+#endif
+
+		size_t         eventQueueCapacity = 0;
+		OverflowPolicy overflowPolicy     = OverflowPolicy::DropOldest;
+	};
+}
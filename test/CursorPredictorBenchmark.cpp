@@ -0,0 +1,163 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Tests.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Input/CursorPredictor.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+namespace Strawberry::Window::Test
+{
+	namespace
+	{
+		struct TraceSample
+		{
+			double           time;
+			Core::Math::Vec2 position;
+		};
+
+
+		// A poll and the samples it dispatched, which may be none.
+		struct TracePoll
+		{
+			double                   time;
+			std::vector<TraceSample> samples;
+		};
+
+
+		std::vector<TracePoll> LoadTrace(const std::string& file)
+		{
+			std::ifstream stream(file);
+			Core::Assert(stream.is_open());
+
+			std::string line;
+			std::getline(stream, line);
+
+			std::vector<TracePoll> polls;
+			while (std::getline(stream, line))
+			{
+				double     pollTime, time, x, y;
+				const auto fields = std::sscanf(line.c_str(), "%lf,%lf,%lf,%lf", &pollTime, &time, &x, &y);
+				Core::Assert(fields == 1 || fields == 4);
+
+				if (polls.empty() || polls.back().time != pollTime)
+				{
+					polls.emplace_back(TracePoll{.time = pollTime, .samples = {}});
+				}
+
+				if (fields == 4)
+				{
+					polls.back().samples.emplace_back(TraceSample{.time = time, .position = Core::Math::Vec2(x, y)});
+				}
+			}
+
+			return polls;
+		}
+
+
+		struct ErrorStatistics
+		{
+			double mean;
+			double p95;
+			double max;
+		};
+
+
+		ErrorStatistics Summarise(std::vector<double> errors)
+		{
+			std::ranges::sort(errors);
+
+			double sum = 0.0;
+			for (double error : errors) sum += error;
+
+			return
+			{
+				.mean = sum / static_cast<double>(errors.size()),
+				.p95 = errors[errors.size() * 95 / 100],
+				.max = errors.back(),
+			};
+		}
+	}
+
+
+	// Replays a cursor trace as GLFW delivers it: roughly one thousand samples a second, batched into 60 Hz polls and
+	// stamped as their callbacks run. After each poll the cursor is predicted to the next poll, and compared with the
+	// last position that poll reports, or with the position it stopped at if that poll reports nothing. Holding the
+	// last reported position is the baseline. Polls with and without motion are scored separately. The trace is written
+	// by Data/GenerateCursorTrace.py.
+	void CursorPredictorBenchmark()
+	{
+		const auto polls = LoadTrace(STRAWBERRY_WINDOW_TEST_DATA "/CursorTrace.csv");
+		Core::Assert(polls.size() > 2);
+
+		const Input::CursorPredictor::Parameters parameters;
+		Input::CursorPredictor                   predictor(parameters);
+
+		std::vector<double> predictedErrors;
+		std::vector<double> baselineErrors;
+		std::vector<double> idleErrors;
+		Core::Math::Vec2    position;
+		double              lastSampleTime = 0.0;
+
+		auto Distance = [] (const Core::Math::Vec2& a, const Core::Math::Vec2& b)
+		{
+			return std::hypot(a[0] - b[0], a[1] - b[1]);
+		};
+
+		for (size_t i = 0; i + 1 < polls.size(); i++)
+		{
+			for (const TraceSample& sample : polls[i].samples)
+			{
+				predictor.AddSample(sample.position, sample.time);
+				position       = sample.position;
+				lastSampleTime = sample.time;
+			}
+
+			const TracePoll& next      = polls[i + 1];
+			const auto       predicted = predictor.Predict(next.time);
+			if (!predicted) continue;
+
+			if (next.samples.empty())
+			{
+				const double error = Distance(predicted.Value(), position);
+				idleErrors.emplace_back(error);
+
+				// Once the cursor has been still for longer than the sample gap, prediction must hold it still too.
+				if (next.time - lastSampleTime > parameters.maxSampleGap) Core::Assert(error == 0.0);
+			}
+			else
+			{
+				predictedErrors.emplace_back(Distance(predicted.Value(), next.samples.back().position));
+				baselineErrors.emplace_back(Distance(position, next.samples.back().position));
+			}
+		}
+
+		const size_t          movingCount = predictedErrors.size();
+		const size_t          idleCount   = idleErrors.size();
+		const ErrorStatistics predicted   = Summarise(std::move(predictedErrors));
+		const ErrorStatistics baseline    = Summarise(std::move(baselineErrors));
+		const ErrorStatistics idle        = Summarise(std::move(idleErrors));
+
+		Core::Logging::Info("CursorPredictor over {} polls with motion: mean {:.2f}px, p95 {:.2f}px, max {:.2f}px",
+		                    movingCount, predicted.mean, predicted.p95, predicted.max);
+		Core::Logging::Info("Last position baseline: mean {:.2f}px, p95 {:.2f}px, max {:.2f}px",
+		                    baseline.mean, baseline.p95, baseline.max);
+		Core::Logging::Info("CursorPredictor over {} polls without motion: mean {:.2f}px, p95 {:.2f}px, max {:.2f}px",
+		                    idleCount, idle.mean, idle.p95, idle.max);
+
+		// Prediction must beat holding the cursor still, and must never overshoot far past the largest movement
+		// between two polls, whether or not the cursor keeps moving.
+		Core::Assert(predicted.mean < baseline.mean);
+		Core::Assert(predicted.max < 2.0 * baseline.max);
+		Core::Assert(idle.max < 2.0 * baseline.max);
+	}
+}
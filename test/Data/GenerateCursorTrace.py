@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+# Generates CursorTrace.csv, the input to CursorPredictorBenchmark.
+#
+# Hand motion is a sequence of minimum jerk strokes between targets, a circle, and pauses. It is sampled the way a
+# 1 kHz mouse reports it, as integer positions only when the position changes, and batched into jittered 60 Hz polls.
+# Each poll stamps its samples as GLFW dispatches them, microseconds apart just after the poll. Polls which dispatch
+# nothing are written as a row with no sample, so that the benchmark can score them too.
+#
+# Columns: poll time, sample time, x, y. Usage: GenerateCursorTrace.py [output]
+import math
+import random
+import sys
+from pathlib import Path
+
+REPORT_RATE = 1000.0
+POLL_RATE = 60.0
+POLL_JITTER = 0.001
+DISPATCH_DELAY = (0.0001, 0.0004)
+DISPATCH_INTERVAL = 0.000004
+PAUSE = 0.15
+TRAILING_IDLE = 0.3
+
+# Each step is a stroke to a target over a duration, a circle through the current position, or a pause.
+PLAN = [
+	("stroke", (1100, 420), 0.45),
+	("pause",),
+	("stroke", (300, 200), 0.6),
+	("stroke", (420, 640), 0.35),
+	("pause",),
+	("circle", 150, 0.9),
+	("stroke", (900, 300), 0.25),
+	("pause",),
+	("stroke", (960, 320), 0.2),
+	("stroke", (200, 500), 0.7),
+]
+
+
+def minimum_jerk(a, b):
+	def position(u):
+		s = 10 * u ** 3 - 15 * u ** 4 + 6 * u ** 5
+		return (a[0] + (b[0] - a[0]) * s, a[1] + (b[1] - a[1]) * s)
+	return position
+
+
+def circle(start, radius):
+	centre = (start[0] - radius, start[1])
+	def position(u):
+		return (centre[0] + radius * math.cos(u * 2 * math.pi), centre[1] + radius * math.sin(u * 2 * math.pi))
+	return position
+
+
+def plan_segments(start):
+	segments = []
+	time = 0.0
+	position = start
+	for step in PLAN:
+		if step[0] == "pause":
+			time += PAUSE
+			continue
+		if step[0] == "circle":
+			_, radius, duration = step
+			path = circle(position, radius)
+		else:
+			_, target, duration = step
+			path = minimum_jerk(position, target)
+		segments.append((time, duration, path))
+		time += duration
+		position = path(1.0)
+	return segments, time
+
+
+def reports(segments, end):
+	result = []
+	last = None
+	for tick in range(int(end * REPORT_RATE)):
+		time = tick / REPORT_RATE
+		position = None
+		for start, duration, path in segments:
+			if start <= time <= start + duration:
+				position = path((time - start) / duration)
+		if position is None:
+			continue
+		position = (round(position[0]), round(position[1]))
+		if position != last:
+			result.append((time, position))
+			last = position
+	return result
+
+
+def main():
+	output = Path(sys.argv[1]) if len(sys.argv) > 1 else Path(__file__).with_name("CursorTrace.csv")
+	random.seed(7)
+
+	segments, end = plan_segments((640.0, 360.0))
+	pending = reports(segments, end)
+	end += TRAILING_IDLE
+
+	rows = []
+	poll = 0.0
+	index = 0
+	while poll < end:
+		poll += 1 / POLL_RATE + random.uniform(-POLL_JITTER, POLL_JITTER)
+		stamp = poll + random.uniform(*DISPATCH_DELAY)
+		batch = []
+		while index < len(pending) and pending[index][0] <= poll:
+			batch.append(pending[index][1])
+			index += 1
+		if not batch:
+			rows.append(f"{poll:.6f},,,")
+		for k, (x, y) in enumerate(batch):
+			rows.append(f"{poll:.6f},{stamp + k * DISPATCH_INTERVAL:.6f},{x},{y}")
+
+	with open(output, "w") as file:
+		file.write("poll,time,x,y\n")
+		file.write("\n".join(rows) + "\n")
+
+
+if __name__ == "__main__":
+	main()
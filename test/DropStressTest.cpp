@@ -0,0 +1,57 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Tests.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Event.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <string>
+#include <vector>
+
+
+namespace Strawberry::Window::Test
+{
+	// Drops many thousands of paths, including non-ASCII ones, and checks every path survives copies of the event.
+	void DropStressTest()
+	{
+		constexpr size_t PathCount = 20000;
+
+		// GLFW reports paths as UTF-8.
+		const std::u8string directories[] = {u8"/assets/textures/", u8"/assets/Größe/", u8"/資産/モデル/"};
+
+		std::vector<std::string> paths;
+		paths.reserve(PathCount);
+		for (size_t i = 0; i < PathCount; i++)
+		{
+			const std::u8string& directory = directories[i % std::size(directories)];
+			paths.emplace_back(std::string(directory.begin(), directory.end()) + "file_" + std::to_string(i) + ".png");
+		}
+
+		std::vector<const char*> pointers;
+		pointers.reserve(PathCount);
+		for (const std::string& path : paths) pointers.emplace_back(path.c_str());
+
+		const Event original = Events::Drop(pointers);
+		const Event copy     = original;
+
+		const auto& drop = copy.Ref<Events::Drop>();
+		Core::Assert(drop.Count() == PathCount);
+		Core::Assert(drop.Paths().size() == PathCount);
+
+		for (size_t i = 0; i < PathCount; i++)
+		{
+			Core::Assert(drop[i] == paths[i]);
+			Core::Assert(drop.Paths()[i].data() == original.Ref<Events::Drop>()[i].data());
+
+			const std::u8string path = drop.Path(i).u8string();
+			Core::Assert(std::string_view(reinterpret_cast<const char*>(path.data()), path.size()) == paths[i]);
+		}
+
+		const Events::Drop empty(std::span<const char* const>{});
+		Core::Assert(empty.Count() == 0 && empty.Paths().empty());
+
+		Core::Logging::Info("Dropped {} paths", drop.Count());
+	}
+}
@@ -0,0 +1,66 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Tests.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Monitor.hpp"
+#include "Strawberry/Window/Window.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+
+
+namespace Strawberry::Window::Test
+{
+	// Enters and leaves exclusive fullscreen, and checks the published geometry matches the monitor's video mode, then
+	// the windowed geometry once restored. Runs on the null platform.
+	void FullscreenTest()
+	{
+		Window window(WindowConfig("Fullscreen Test", Core::Math::Vec2i(640, 480)));
+		PollInput();
+
+		const WindowState windowed = window.GetState();
+		Core::Assert(windowed.size[0] == 640 && windowed.size[1] == 480);
+
+		const std::vector<MonitorInfo> monitors = GetMonitorInfo();
+		Core::Assert(!monitors.empty());
+
+		const MonitorInfo& monitor = monitors.front();
+		Core::Assert(monitor.mHandle != nullptr);
+		Core::Assert(!monitor.mVideoModes.empty());
+
+		const Core::Math::Vec2u resolution = monitor.mCurrentVideoMode.mResolution;
+		auto IsFullscreenGeometry = [&] (const WindowState& state)
+		{
+			return static_cast<unsigned>(state.size[0]) == resolution[0]
+				&& static_cast<unsigned>(state.size[1]) == resolution[1]
+				&& static_cast<unsigned>(state.framebufferSize[0]) == resolution[0]
+				&& static_cast<unsigned>(state.framebufferSize[1]) == resolution[1];
+		};
+
+		// The fullscreen geometry is published without waiting for a poll.
+		window.EnterFullscreen(monitor);
+		Core::Assert(window.IsFullscreen());
+		Core::Assert(IsFullscreenGeometry(window.GetState()));
+
+		PollInput();
+		Core::Assert(IsFullscreenGeometry(window.GetState()));
+
+		// Entering again while fullscreen must keep the windowed geometry saved by the first call. The null platform
+		// has a single video mode, so this does not switch modes.
+		window.EnterFullscreen(monitor);
+		PollInput();
+		Core::Assert(window.IsFullscreen());
+		Core::Assert(IsFullscreenGeometry(window.GetState()));
+
+		window.LeaveFullscreen();
+		Core::Assert(!window.IsFullscreen());
+
+		const WindowState restored = window.GetState();
+		Core::Assert(restored.size[0] == windowed.size[0] && restored.size[1] == windowed.size[1]);
+		Core::Assert(restored.position[0] == windowed.position[0] && restored.position[1] == windowed.position[1]);
+
+		// Leaving again is a no-op.
+		window.LeaveFullscreen();
+		Core::Assert(!window.IsFullscreen());
+	}
+}
@@ -1,8 +1,18 @@
 #include "Strawberry/Window/Window.hpp"
+#include "Tests.hpp"
 
 
 int main()
 {
 	using namespace Strawberry::Window;
+
+	// Tests which create windows run headless.
+	GLFWLibrary::SetPlatform(GLFWLibrary::Platform::Null);
+
+	Test::CursorPredictorBenchmark();
+	Test::DropStressTest();
+	Test::FullscreenTest();
+	Test::PipelineBenchmark();
+	Test::SharedEventChannelTest();
 	return 0;
 }
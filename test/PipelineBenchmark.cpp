@@ -0,0 +1,179 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Tests.hpp"
+// Strawberry Window
+#include "Strawberry/Window/Window.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+
+namespace Strawberry::Window::Test
+{
+	namespace
+	{
+		using namespace Input;
+
+
+		constexpr size_t EventCount  = 1 << 16;
+		constexpr size_t Repetitions = 32;
+
+
+		std::vector<Event> MakeEvents()
+		{
+			std::vector<Event> events;
+			events.reserve(EventCount);
+
+			for (size_t i = 0; i < EventCount; i++)
+			{
+				const float value = static_cast<float>(i % 17) - 8.0f;
+				switch (i % 4)
+				{
+					case 0:
+						events.emplace_back(Events::Key
+						{
+							.keyCode = KeyCode::A,
+							.scanCode = 0,
+							.modifiers = 0,
+							.action = i % 8 == 0 ? KeyAction::Repeat : KeyAction::Press
+						});
+						break;
+					case 1:
+						events.emplace_back(Events::MouseMove{.position = {0.0f, 0.0f}, .deltaPosition = {value, -value}});
+						break;
+					case 2:
+						events.emplace_back(Events::MouseScroll{.scroll = {value, value * 0.5f}});
+						break;
+					default:
+						events.emplace_back(Events::Text{.codepoint = U'a'});
+						break;
+				}
+			}
+
+			return events;
+		}
+
+
+		// The stages of Pipeline<DropRepeat, Remap, MouseAccel, ClampScroll>, written out by hand.
+		bool HandWritten(Event& event, const std::array<KeyCode, KeyCodeCount>& mapping, float sensitivity, float acceleration, float limit)
+		{
+			if (event.IsType<Events::Key>())
+			{
+				auto& key = event.Ref<Events::Key>();
+				if (key.action == KeyAction::Repeat) return false;
+				key.keyCode = mapping[static_cast<size_t>(key.keyCode)];
+			}
+			else if (event.IsType<Events::MouseMove>())
+			{
+				auto&       delta = event.Ref<Events::MouseMove>().deltaPosition;
+				const float gain  = sensitivity * (1.0f + acceleration * std::hypot(delta[0], delta[1]));
+				delta[0] *= gain;
+				delta[1] *= gain;
+			}
+			else if (event.IsType<Events::MouseScroll>())
+			{
+				auto& scroll = event.Ref<Events::MouseScroll>().scroll;
+				scroll[0] = std::clamp(scroll[0], -limit, limit);
+				scroll[1] = std::clamp(scroll[1], -limit, limit);
+			}
+
+			return true;
+		}
+
+
+		// The hand written stages as a single stage, so that it runs through the same dispatch path.
+		struct HandWrittenStage
+		{
+			std::array<KeyCode, KeyCodeCount> mapping;
+
+
+			bool operator()(Event& event) const
+			{
+				return HandWritten(event, mapping, 1.5f, 0.1f, 3.0f);
+			}
+		};
+
+
+		// Pipeline stages hidden behind an indirect call.
+		struct ErasedStage
+		{
+			std::function<bool(Event&)> function;
+
+
+			bool operator()(Event& event) const
+			{
+				return function(event);
+			}
+		};
+
+
+		// Best time per event spent in PollInput() over all repetitions, in nanoseconds. The events are submitted to the
+		// window before each poll, and read back afterwards into a checksum which keeps the work observable.
+		template<PipelineStage... Stages>
+		double Measure(Window& window, const std::vector<Event>& events, Pipeline<Stages...>& pipeline, size_t& checksum)
+		{
+			double best = std::numeric_limits<double>::max();
+
+			for (size_t repetition = 0; repetition < Repetitions; repetition++)
+			{
+				for (const Event& event : events)
+				{
+					window.SubmitEvent(event);
+				}
+
+				const auto start = std::chrono::steady_clock::now();
+				PollInput(pipeline);
+				const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+				while (auto event = window.NextEvent())
+				{
+					checksum += event->IsType<Events::Key>() ? static_cast<size_t>(event->Ref<Events::Key>().keyCode) : 1;
+				}
+
+				best = std::min(best, elapsed.count() / static_cast<double>(events.size()));
+			}
+
+			return best;
+		}
+	}
+
+
+	// Runs the same stages through PollInput() as hand written code, as a composed pipeline, and behind an indirect
+	// call. Timings are reported only, as wall clock comparisons are too noisy to assert on.
+	void PipelineBenchmark()
+	{
+		const std::vector<Event> events = MakeEvents();
+		Window                   window(WindowConfig("Pipeline Benchmark", Core::Math::Vec2i(640, 480)));
+
+		Remap remap;
+		remap.Map(KeyCode::A, KeyCode::B);
+
+		HandWrittenStage handWrittenStage;
+		for (size_t i = 0; i < KeyCodeCount; i++) handWrittenStage.mapping[i] = static_cast<KeyCode>(i);
+		handWrittenStage.mapping[static_cast<size_t>(KeyCode::A)] = KeyCode::B;
+
+		Pipeline handWrittenPipeline(handWrittenStage);
+		Pipeline pipeline(DropRepeat{}, remap, MouseAccel{.sensitivity = 1.5f, .acceleration = 0.1f}, ClampScroll{.limit = 3.0f});
+		Pipeline erasedPipeline(ErasedStage{.function = pipeline});
+
+		size_t handWrittenChecksum = 0;
+		size_t pipelineChecksum    = 0;
+		size_t erasedChecksum      = 0;
+
+		const double handWritten = Measure(window, events, handWrittenPipeline, handWrittenChecksum);
+		const double composed    = Measure(window, events, pipeline, pipelineChecksum);
+		const double typeErased  = Measure(window, events, erasedPipeline, erasedChecksum);
+
+		Core::Assert(handWrittenChecksum == pipelineChecksum && pipelineChecksum == erasedChecksum);
+
+		Core::Logging::Info("PollInput per event: hand written {:.2f}ns, pipeline {:.2f}ns, type erased pipeline {:.2f}ns",
+		                    handWritten, composed, typeErased);
+	}
+}
@@ -0,0 +1,90 @@
+//======================================================================================================================
+//  Includes
+//----------------------------------------------------------------------------------------------------------------------
+#include "Tests.hpp"
+// Strawberry Window
+#include "Strawberry/Window/SharedEventChannel.hpp"
+// Strawberry Core
+#include "Strawberry/Core/Assert.hpp"
+// Standard Library
+#include <random>
+#include <string>
+
+
+namespace Strawberry::Window::Test
+{
+	namespace
+	{
+		EventRecord MakeRecord(uint32_t code)
+		{
+			EventRecord record{};
+			record.type = EventRecord::Type::Text;
+			record.code = code;
+			return record;
+		}
+	}
+
+
+	// Fills and wraps both rings of a small channel. A reader which falls behind must skip to the oldest record still
+	// held and count exactly the records it lost, and the injected ring must refuse records once full and keep its
+	// order across wraps.
+	void SharedEventChannelTest()
+	{
+		constexpr uint32_t Capacity = 8;
+
+		const std::string name = "StrawberryWindowTest-" + std::to_string(std::random_device()());
+		auto channel = SharedEventChannel::Create(name, Capacity);
+		if (!channel)
+		{
+			Core::Logging::Info("SharedEventChannelTest skipped, shared memory is not available");
+			return;
+		}
+
+		auto reader   = SharedEventReader::Open(name);
+		auto injector = SharedEventInjector::Open(name);
+		Core::Assert(reader.HasValue() && injector.HasValue());
+
+
+		// Published ring. Reading keeps up for a while, then falls behind by more than a full ring.
+		uint32_t published = 0;
+		for (; published < Capacity / 2; published++) channel->Publish(MakeRecord(published));
+		for (uint32_t expected = 0; expected < Capacity / 2; expected++)
+		{
+			auto record = reader->Read();
+			Core::Assert(record.HasValue() && record->code == expected);
+		}
+		Core::Assert(reader->GetLostCount() == 0);
+
+		constexpr uint32_t Overrun = 3;
+		for (; published < Capacity / 2 + 2 * Capacity + Overrun; published++) channel->Publish(MakeRecord(published));
+
+		uint32_t expected = published - Capacity;
+		while (auto record = reader->Read())
+		{
+			Core::Assert(record->code == expected++);
+		}
+		Core::Assert(expected == published);
+		Core::Assert(reader->GetLostCount() == Capacity + Overrun);
+		Core::Assert(!reader->Read().HasValue());
+
+
+		// Injected ring. Filled, drained and refilled three times, so its indices wrap.
+		uint32_t injected = 0;
+		uint32_t drained  = 0;
+		for (int round = 0; round < 3; round++)
+		{
+			for (uint32_t i = 0; i < Capacity; i++)
+			{
+				Core::Assert(injector->Inject(MakeRecord(injected++)));
+			}
+			Core::Assert(!injector->Inject(MakeRecord(injected)));
+
+			channel->DrainInjected([&] (const EventRecord& record)
+			{
+				Core::Assert(record.code == drained++);
+				Core::Assert((record.flags & EventRecord::Injected) != 0);
+			});
+			Core::Assert(drained == injected);
+		}
+	}
+}
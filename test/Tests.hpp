@@ -0,0 +1,11 @@
+#pragma once
+
+
+namespace Strawberry::Window::Test
+{
+	void CursorPredictorBenchmark();
+	void DropStressTest();
+	void FullscreenTest();
+	void PipelineBenchmark();
+	void SharedEventChannelTest();
+}